@@ -0,0 +1,179 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+// ============================================================
+//  Harness mínimo de benchmarks
+//
+//  Cada caso recebe um Measure e devolve quantas operações
+//  executou. Só o que roda dentro de m.time(...) é cronometrado
+//  e tem alocações contadas; setup fica fora.
+//
+//  Alocações vêm dos operator new/delete substituídos em
+//  main.cpp (bench::allocationCount / allocatedBytes).
+// ============================================================
+
+namespace bench {
+
+std::uint64_t allocationCount();
+std::uint64_t allocatedBytes();
+
+// Obriga o valor a existir a cada chamada: sem isso o compilador enxerga
+// o laço medido inteiro e pode trocá-lo por uma fórmula fechada
+template<typename T>
+inline void doNotOptimize(T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    volatile T* sink = &value;
+    value = *sink;
+#endif
+}
+
+struct Result {
+    std::string name;
+    std::uint64_t ops = 0;
+    double seconds = 0.0;
+    std::uint64_t allocations = 0;
+    std::uint64_t bytes = 0;
+
+    double nsPerOp() const { return ops ? seconds * 1e9 / static_cast<double>(ops) : 0.0; }
+    double opsPerSec() const { return seconds > 0.0 ? static_cast<double>(ops) / seconds : 0.0; }
+    double allocsPerOp() const { return ops ? static_cast<double>(allocations) / static_cast<double>(ops) : 0.0; }
+    double bytesPerOp() const { return ops ? static_cast<double>(bytes) / static_cast<double>(ops) : 0.0; }
+};
+
+class Measure {
+public:
+    template<typename Func>
+    void time(Func&& fn) {
+        std::uint64_t a0 = allocationCount();
+        std::uint64_t b0 = allocatedBytes();
+        auto t0 = std::chrono::steady_clock::now();
+        fn();
+        auto t1 = std::chrono::steady_clock::now();
+        seconds += std::chrono::duration<double>(t1 - t0).count();
+        allocations += allocationCount() - a0;
+        bytes += allocatedBytes() - b0;
+    }
+
+private:
+    friend class Runner;
+    double seconds = 0.0;
+    std::uint64_t allocations = 0;
+    std::uint64_t bytes = 0;
+};
+
+class Runner {
+public:
+    using Body = std::function<std::uint64_t(Measure&)>;
+
+    double minSeconds = 0.2;
+    int minReps = 3;
+    int maxReps = 1000;
+    std::string filter;
+
+    void add(std::string name, Body body) {
+        cases.push_back({std::move(name), std::move(body)});
+    }
+
+    // Repete cada caso até somar minSeconds de tempo medido
+    std::vector<Result> run() {
+        std::vector<Result> results;
+        std::printf("%-48s %12s %14s %10s %12s\n", "benchmark", "ns/op", "ops/s", "allocs/op", "bytes/op");
+        for (auto& c : cases) {
+            if (!filter.empty() && c.name.find(filter) == std::string::npos) continue;
+            Measure m;
+            Result r;
+            r.name = c.name;
+            c.body(m);  // aquecimento
+            m = Measure{};
+            for (int rep = 0; rep < maxReps && (rep < minReps || m.seconds < minSeconds); ++rep) {
+                r.ops += c.body(m);
+            }
+            r.seconds = m.seconds;
+            r.allocations = m.allocations;
+            r.bytes = m.bytes;
+            std::printf("%-48s %12.2f %14.0f %10.3f %12.1f\n", r.name.c_str(),
+                        r.nsPerOp(), r.opsPerSec(), r.allocsPerOp(), r.bytesPerOp());
+            std::fflush(stdout);
+            results.push_back(r);
+        }
+        return results;
+    }
+
+private:
+    struct Case {
+        std::string name;
+        Body body;
+    };
+    std::vector<Case> cases;
+};
+
+// Uma linha JSON por resultado, fácil de diffar e de ler de volta
+inline bool writeJson(const std::string& path, const std::vector<Result>& results) {
+    std::FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) return false;
+    for (const auto& r : results) {
+        std::fprintf(f,
+            "{\"name\":\"%s\",\"ops\":%llu,\"ns_per_op\":%.4f,\"ops_per_sec\":%.1f,"
+            "\"allocs_per_op\":%.4f,\"bytes_per_op\":%.2f}\n",
+            r.name.c_str(), static_cast<unsigned long long>(r.ops), r.nsPerOp(), r.opsPerSec(),
+            r.allocsPerOp(), r.bytesPerOp());
+    }
+    return std::fclose(f) == 0;
+}
+
+struct BaselineEntry {
+    std::string name;
+    double nsPerOp;
+};
+
+inline std::vector<BaselineEntry> readJson(const std::string& path) {
+    std::vector<BaselineEntry> out;
+    std::FILE* f = std::fopen(path.c_str(), "r");
+    if (!f) return out;
+    char line[1024];
+    while (std::fgets(line, sizeof(line), f)) {
+        std::string s(line);
+        auto n0 = s.find("\"name\":\"");
+        auto v0 = s.find("\"ns_per_op\":");
+        if (n0 == std::string::npos || v0 == std::string::npos) continue;
+        n0 += 8;
+        auto n1 = s.find('"', n0);
+        out.push_back({s.substr(n0, n1 - n0), std::stod(s.substr(v0 + 12))});
+    }
+    std::fclose(f);
+    return out;
+}
+
+// Compara com uma execução anterior; devolve quantos casos ficaram mais lentos que `tolerance`
+inline int compare(const std::vector<Result>& results, const std::vector<BaselineEntry>& baseline,
+                   double tolerance) {
+    int regressions = 0;
+    for (const auto& r : results) {
+        auto it = std::find_if(baseline.begin(), baseline.end(),
+                               [&](const BaselineEntry& b) { return b.name == r.name; });
+        if (it == baseline.end() || it->nsPerOp <= 0.0) continue;
+        double ratio = r.nsPerOp() / it->nsPerOp;
+        if (ratio > 1.0 + tolerance) {
+            std::printf("REGRESSAO %-40s %10.2f -> %10.2f ns/op (x%.2f)\n",
+                        r.name.c_str(), it->nsPerOp, r.nsPerOp(), ratio);
+            ++regressions;
+        }
+    }
+    return regressions;
+}
+
+// Registro das suítes (um arquivo .cpp cada)
+void registerEcs(Runner& runner);
+void registerCombatEvents(Runner& runner);
+void registerEngine(Runner& runner);
+void registerSimd(Runner& runner);
+
+} // namespace bench
@@ -0,0 +1,162 @@
+#include "Bench.hpp"
+#include "../ecs-example/Events.hpp"
+#include "../ecs-example/Components.h"
+#include "../ecs-example/Systems.h"
+#include "../ecs-example/Journal.h"
+#include <functional>
+#include <random>
+
+namespace {
+
+struct HitCounter {
+    long long hits = 0;
+    void on(const AttackEvent& e) {
+        hits += e.target;
+        bench::doNotOptimize(hits);
+    }
+};
+
+// Referência: um handler por ataque, com as buscas de componente a cada evento
+struct PerEventCombat {
+    ECS& ecs;
+    void on(const AttackEvent& e) {
+        auto atk = ecs.getComponent<const StatsComponent>(e.source);
+        auto targetHp = ecs.getComponent<HealthComponent>(e.target);
+        if (atk && targetHp) targetHp->currentHP -= atk->attack;
+    }
+};
+
+// 100k ataques por tick entre 1000 combatentes
+struct Arena {
+    ECS ecs;
+    std::vector<AttackEvent> attacks;
+
+    Arena() {
+        std::vector<EntityID> fighters;
+        for (int i = 0; i < 1000; ++i) {
+            EntityID e = ecs.createEntity();
+            ecs.addComponent(e, HealthComponent{1'000'000, 1'000'000});
+            ecs.addComponent(e, StatsComponent{3, 1});
+            fighters.push_back(e);
+        }
+        std::mt19937 rng(3);
+        for (int i = 0; i < 100'000; ++i) {
+            attacks.push_back(AttackEvent{fighters[rng() % fighters.size()], fighters[rng() % fighters.size()]});
+        }
+    }
+};
+
+// Os mesmos 100k ataques em 100 ticks, com checkpoint a cada tick
+std::vector<std::uint8_t> recordArena(Arena& arena, bool checkpoints) {
+    CombatSystem combat(arena.ecs);
+    EventJournal<CombatEvents> journal;
+    EventBus<CombatEvents, CombatSystem, EventJournal<CombatEvents>> bus(combat, journal);
+    const std::size_t perTick = arena.attacks.size() / 100;
+    for (std::uint32_t t = 0; t < 100; ++t) {
+        journal.tick(t);
+        for (std::size_t i = 0; i < perTick; ++i) bus.post(arena.attacks[t * perTick + i]);
+        bus.flush();
+        if (checkpoints) journal.checkpoint(hashState<HealthComponent>(arena.ecs));
+    }
+    return journal.bytes();
+}
+
+template<typename Bus>
+std::uint64_t sendLoop(bench::Measure& m, Bus& bus) {
+    const std::uint64_t n = 100'000;
+    m.time([&] {
+        for (std::uint64_t i = 0; i < n; ++i) bus.send(AttackEvent{0, static_cast<EntityID>(i & 1)});
+    });
+    return n;
+}
+
+} // namespace
+
+void bench::registerCombatEvents(Runner& runner) {
+    // Despacho puro: tabela de std::function (modelo antigo) contra handlers em compilação.
+    // Todo handler passa o acumulador por doNotOptimize, senão o laço do bus (todo
+    // inlined) vira fórmula fechada e mede 0 ns. Com isso: 1 handler empata
+    // (~2.7 contra ~3 ns); com 4, ~3 ns contra ~11 ns
+    for (int subscribers : {1, 4, 16}) {
+        runner.add("combat/std::function/subs=" + std::to_string(subscribers),
+            [subscribers](Measure& m) -> std::uint64_t {
+                const std::uint64_t n = 100'000;
+                std::vector<std::function<void(const AttackEvent&)>> listeners;
+                long long hits = 0;
+                for (int s = 0; s < subscribers; ++s) {
+                    listeners.push_back([&hits](const AttackEvent& e) {
+                        hits += e.target;
+                        bench::doNotOptimize(hits);
+                    });
+                }
+                m.time([&] {
+                    for (std::uint64_t i = 0; i < n; ++i) {
+                        AttackEvent e{0, static_cast<EntityID>(i & 1)};
+                        for (auto& cb : listeners) cb(e);
+                    }
+                });
+                if (hits == -1) std::printf("!");
+                return n;
+            });
+    }
+
+    runner.add("combat/EventBus::send/handlers=1", [](Measure& m) -> std::uint64_t {
+        HitCounter a;
+        EventBus<EventList<AttackEvent>, HitCounter> bus(a);
+        std::uint64_t n = sendLoop(m, bus);
+        if (a.hits == -1) std::printf("!");
+        return n;
+    });
+
+    runner.add("combat/EventBus::send/handlers=4", [](Measure& m) -> std::uint64_t {
+        HitCounter a, b, c, d;
+        EventBus<EventList<AttackEvent>, HitCounter, HitCounter, HitCounter, HitCounter> bus(a, b, c, d);
+        std::uint64_t n = sendLoop(m, bus);
+        if (a.hits + b.hits + c.hits + d.hits == -1) std::printf("!");
+        return n;
+    });
+
+    // Ataques reais: entrega evento a evento contra lote somado por alvo.
+    // Com 1000 combatentes tudo fica no cache e o send ganha (~7 contra ~10 ns)
+    runner.add("combat/attacks/send", [](Measure& m) -> std::uint64_t {
+        Arena arena;
+        PerEventCombat combat{arena.ecs};
+        EventBus<CombatEvents, PerEventCombat> bus(combat);
+        m.time([&] {
+            for (const AttackEvent& e : arena.attacks) bus.send(e);
+        });
+        return arena.attacks.size();
+    });
+
+    runner.add("combat/attacks/post+flush", [](Measure& m) -> std::uint64_t {
+        Arena arena;
+        CombatSystem combat(arena.ecs);
+        EventBus<CombatEvents, CombatSystem> bus(combat);
+        m.time([&] {
+            for (const AttackEvent& e : arena.attacks) bus.post(e);
+            bus.flush();
+        });
+        return arena.attacks.size();
+    });
+
+    // Journal: custo de gravar cada evento e replay de 100 ticks com checkpoints
+    runner.add("combat/journal/record", [](Measure& m) -> std::uint64_t {
+        Arena arena;
+        m.time([&] { recordArena(arena, false); });
+        return arena.attacks.size();
+    });
+
+    runner.add("combat/journal/replay", [](Measure& m) -> std::uint64_t {
+        Arena recorded;
+        std::vector<std::uint8_t> data = recordArena(recorded, true);
+        Arena arena;
+        CombatSystem combat(arena.ecs);
+        EventBus<CombatEvents, CombatSystem> bus(combat);
+        bool ok = false;
+        m.time([&] {
+            ok = replayJournal(CombatEvents{}, data, bus, [&] { return hashState<HealthComponent>(arena.ecs); }).ok;
+        });
+        if (!ok) std::printf("replay divergiu\n");
+        return arena.attacks.size();
+    });
+}
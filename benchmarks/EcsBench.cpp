@@ -0,0 +1,178 @@
+#include "Bench.hpp"
+#include "../ecs-example/ECS.h"
+#include "../ecs-example/Components.h"
+#include "../ecs-example/FieldIndex.h"
+#include "../ecs-example/Prefab.h"
+#include <memory>
+#include <numeric>
+#include <random>
+
+namespace {
+
+struct PopulatedWorld {
+    ECS ecs;
+    std::vector<EntityID> lookupOrder;
+
+    explicit PopulatedWorld(std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            EntityID e = ecs.createEntity();
+            ecs.addComponent(e, HealthComponent{100, static_cast<int>(i % 100)});
+            ecs.addComponent(e, StatsComponent{static_cast<int>(i % 13), 2});
+        }
+        lookupOrder = ecs.getEntities();
+        std::shuffle(lookupOrder.begin(), lookupOrder.end(), std::mt19937(7));
+    }
+};
+
+} // namespace
+
+void bench::registerEcs(Runner& runner) {
+    for (std::size_t n : {std::size_t(1'000), std::size_t(10'000), std::size_t(100'000), std::size_t(1'000'000)}) {
+        std::string suffix = "/" + std::to_string(n);
+
+        runner.add("ecs/createEntity" + suffix, [n](Measure& m) -> std::uint64_t {
+            ECS ecs;
+            m.time([&] {
+                for (std::size_t i = 0; i < n; ++i) ecs.createEntity();
+            });
+            return n;
+        });
+
+        runner.add("ecs/addComponent" + suffix, [n](Measure& m) -> std::uint64_t {
+            ECS ecs;
+            for (std::size_t i = 0; i < n; ++i) ecs.createEntity();
+            const auto& ids = ecs.getEntities();
+            m.time([&] {
+                for (EntityID id : ids) ecs.addComponent(id, HealthComponent{100, 100});
+            });
+            return n;
+        });
+
+        // Onda de minions: createEntity + addComponent por entidade contra prefab em lote
+        runner.add("ecs/spawn/loop" + suffix, [n](Measure& m) -> std::uint64_t {
+            ECS ecs;
+            m.time([&] {
+                for (std::size_t i = 0; i < n; ++i) {
+                    EntityID e = ecs.createEntity();
+                    ecs.addComponent(e, NameComponent{"Minion"});
+                    ecs.addComponent(e, HealthComponent{30, 30});
+                    ecs.addComponent(e, StatsComponent{4, 1});
+                }
+            });
+            return n;
+        });
+
+        runner.add("ecs/spawn/prefab" + suffix, [n](Measure& m) -> std::uint64_t {
+            ECS ecs;
+            Prefab minion;
+            minion.with(NameComponent{"Minion"}).with(HealthComponent{30, 30}).with(StatsComponent{4, 1});
+            m.time([&] { ecs.createEntities(n, minion); });
+            return n;
+        });
+
+        // O mesmo prefab instanciado um a um: reservas por lote não podem virar O(n²)
+        runner.add("ecs/spawn/prefabEach" + suffix, [n](Measure& m) -> std::uint64_t {
+            ECS ecs;
+            Prefab minion;
+            minion.with(NameComponent{"Minion"}).with(HealthComponent{30, 30}).with(StatsComponent{4, 1});
+            m.time([&] {
+                for (std::size_t i = 0; i < n; ++i) minion.instantiate(ecs);
+            });
+            return n;
+        });
+
+        // Limpar a cena: destroyEntity um a um contra ECS::clear()
+        auto fill = [n](ECS& ecs) {
+            for (std::size_t i = 0; i < n; ++i) {
+                EntityID e = ecs.createEntity();
+                ecs.addComponent(e, HealthComponent{100, 100});
+                ecs.addComponent(e, StatsComponent{1, 1});
+            }
+        };
+
+        runner.add("ecs/destroyAll" + suffix, [n, fill](Measure& m) -> std::uint64_t {
+            ECS ecs;
+            fill(ecs);
+            std::vector<EntityID> ids = ecs.getEntities();
+            m.time([&] {
+                for (EntityID id : ids) ecs.destroyEntity(id);
+            });
+            return n;
+        });
+
+        runner.add("ecs/clear" + suffix, [n, fill](Measure& m) -> std::uint64_t {
+            ECS ecs;
+            fill(ecs);
+            m.time([&] { ecs.clear(); });
+            return n;
+        });
+
+        // Multidão de mesmo nome: depois do primeiro, internar é só um lookup
+        runner.add("ecs/addComponent/name" + suffix, [n](Measure& m) -> std::uint64_t {
+            ECS ecs;
+            for (std::size_t i = 0; i < n; ++i) ecs.createEntity();
+            const auto& ids = ecs.getEntities();
+            m.time([&] {
+                for (EntityID id : ids) ecs.addComponent(id, NameComponent{"Minion"});
+            });
+            return n;
+        });
+
+        auto world = std::make_shared<std::unique_ptr<PopulatedWorld>>();
+        auto populated = [world, n]() -> PopulatedWorld& {
+            if (!*world) *world = std::make_unique<PopulatedWorld>(n);
+            return **world;
+        };
+
+        runner.add("ecs/getComponent/random" + suffix, [populated, n](Measure& m) -> std::uint64_t {
+            PopulatedWorld& w = populated();
+            long long sum = 0;
+            m.time([&] {
+                for (EntityID id : w.lookupOrder) {
+                    if (auto* hp = w.ecs.getComponent<const HealthComponent>(id)) sum += hp->currentHP;
+                }
+            });
+            if (sum == -1) std::printf("!");
+            return n;
+        });
+
+        runner.add("ecs/iterate/view2" + suffix, [populated, n](Measure& m) -> std::uint64_t {
+            PopulatedWorld& w = populated();
+            long long sum = 0;
+            m.time([&] {
+                w.ecs.view<const HealthComponent, const StatsComponent>().each(
+                    [&](EntityID, const HealthComponent& hp, const StatsComponent& st) {
+                        sum += hp.currentHP * st.attack;
+                    });
+            });
+            if (sum == -1) std::printf("!");
+            return n;
+        });
+
+        // "Quem morreu?" com 100 alterações por consulta: varredura contra índice
+        runner.add("ecs/query/deadScan" + suffix, [populated](Measure& m) -> std::uint64_t {
+            PopulatedWorld& w = populated();
+            std::vector<EntityID> dead;
+            m.time([&] {
+                for (std::size_t i = 0; i < 100; ++i) w.ecs.getComponent<HealthComponent>(w.lookupOrder[i])->currentHP ^= 1;
+                dead.clear();
+                w.ecs.view<const HealthComponent>().each([&](EntityID id, const HealthComponent& hp) {
+                    if (hp.currentHP <= 0) dead.push_back(id);
+                });
+            });
+            return 1;
+        });
+
+        runner.add("ecs/query/deadIndex" + suffix, [populated](Measure& m) -> std::uint64_t {
+            PopulatedWorld& w = populated();
+            w.ecs.index<&HealthComponent::currentHP>();
+            std::size_t dead = 0;
+            m.time([&] {
+                for (std::size_t i = 0; i < 100; ++i) w.ecs.getComponent<HealthComponent>(w.lookupOrder[i])->currentHP ^= 1;
+                dead += w.ecs.index<&HealthComponent::currentHP>().atMost(0).size();
+            });
+            if (dead == 1) std::printf("!");
+            return 1;
+        });
+    }
+}
@@ -0,0 +1,325 @@
+#include "Bench.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../ecs-sfml-engine/Engine/Events/EventBus.hpp"
+#include "../ecs-sfml-engine/Engine/Threading/SharedState.hpp"
+#include "../ecs-sfml-engine/Engine/Renderer/SpriteBatch.hpp"
+#include "../ecs-sfml-engine/Engine/UI/TextLayer.hpp"
+
+namespace {
+
+// Mesmo formato do payload de "button_clicked"
+struct BenchClick {
+    int index;
+    std::string_view label;
+};
+
+// Fonte monoespaçada de mentira (atlas 16x16 de células 8x14, sem kerning).
+// Como sf::Font, acha cada glyph numa tabela de hash por code point + estilo.
+class MonoGlyphs : public GlyphSource {
+public:
+    MonoGlyphs() {
+        for (char32_t c = 0; c < 256; ++c) {
+            float col = static_cast<float>(c % 16), row = static_cast<float>(c / 16);
+            for (std::uint64_t bold : {0u, 1u})
+                m_table[(bold << 32) | c] = GlyphMetrics{8.f, 0.f, -10.f, 7.f, 13.f, col * 8.f, row * 14.f, 7.f, 13.f};
+        }
+    }
+    unsigned characterSize() const override { return 13; }
+    GlyphMetrics glyph(char32_t c, bool bold) override {
+        auto it = m_table.find((std::uint64_t(bold) << 32) | c);
+        return it != m_table.end() ? it->second : GlyphMetrics{};
+    }
+    float kerning(char32_t, char32_t, bool) override { return 0.f; }
+
+private:
+    std::unordered_map<std::uint64_t, GlyphMetrics> m_table;
+};
+
+// Linhas como as do console, com número para variar o texto
+std::vector<std::string> consoleLines(std::size_t n) {
+    std::vector<std::string> lines;
+    for (std::size_t i = 0; i < n; ++i)
+        lines.push_back("[sim] +1000 entidades (total " + std::to_string(i * 1000) + ") linha " + std::to_string(i));
+    return lines;
+}
+
+// Itens como os do preview: 3 camadas, 2 materiais, sem textura, em ordem de entidade
+std::vector<RenderItem> previewItems(std::size_t n) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> pos(0.f, 1000.f);
+    std::vector<RenderItem> items(n);
+    for (RenderItem& it : items) {
+        it.prevX = pos(rng);
+        it.prevY = pos(rng);
+        it.x     = it.prevX + 2.f;
+        it.y     = it.prevY - 2.f;
+        it.size  = 5.f;
+        it.color = 0xC0D0FFFFu;
+        it.key   = batchKey(static_cast<std::uint8_t>(rng() % 3), static_cast<std::uint8_t>(rng() % 4 == 0), 0);
+    }
+    return items;
+}
+
+} // namespace
+
+void bench::registerEngine(Runner& runner) {
+    for (int subscribers : {1, 4, 16}) {
+        // Tópico próprio por caso: o bus é singleton e não tem unsubscribe
+        auto topic = engine::EventBus::instance().topic<BenchClick>("bench_" + std::to_string(subscribers));
+        auto hits = std::make_shared<std::atomic<long long>>(0);
+        for (int s = 0; s < subscribers; ++s) {
+            engine::EventBus::instance().subscribe(topic, [hits](const BenchClick& e) {
+                hits->fetch_add(static_cast<long long>(e.label.size()), std::memory_order_relaxed);
+            });
+        }
+
+        runner.add("engine/EventBus::publish/subs=" + std::to_string(subscribers),
+            [topic](Measure& m) -> std::uint64_t {
+                const std::uint64_t n = 100'000;
+                auto& bus = engine::EventBus::instance();
+                m.time([&] {
+                    for (std::uint64_t i = 0; i < n; ++i) bus.publish(topic, BenchClick{0, "1. Spawn Entity"});
+                });
+                return n;
+            });
+    }
+
+    // Publishers concorrentes no mesmo tópico; o handler só escreve em estado da própria thread
+    {
+        auto topic = engine::EventBus::instance().topic<BenchClick>("bench_threads");
+        for (int s = 0; s < 4; ++s) {
+            engine::EventBus::instance().subscribe(topic, [](const BenchClick& e) {
+                thread_local long long seen = 0;
+                seen += static_cast<long long>(e.label.size());
+            });
+        }
+        for (unsigned publishers : {1u, 4u}) {
+            runner.add("engine/EventBus::publish/subs=4/threads=" + std::to_string(publishers),
+                [topic, publishers](Measure& m) -> std::uint64_t {
+                    const std::uint64_t perThread = 100'000;
+                    m.time([&] {
+                        std::vector<std::thread> threads;
+                        for (unsigned t = 0; t < publishers; ++t) {
+                            threads.emplace_back([&] {
+                                auto& bus = engine::EventBus::instance();
+                                for (std::uint64_t i = 0; i < perThread; ++i) bus.publish(topic, BenchClick{0, "1. Spawn Entity"});
+                            });
+                        }
+                        for (auto& t : threads) t.join();
+                    });
+                    return perThread * publishers;
+                });
+        }
+    }
+
+    // Handler lento (~2µs): publish inline paga o handler; publishAsync só enfileira
+    {
+        auto topic = engine::EventBus::instance().topic<BenchClick>("bench_slow");
+        engine::EventBus::instance().subscribe(topic, [](const BenchClick&) {
+            auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(2);
+            while (std::chrono::steady_clock::now() < until) {}
+        });
+        runner.add("engine/EventBus::publish/slowHandler", [topic](Measure& m) -> std::uint64_t {
+            const std::uint64_t n = 2'000;
+            auto& bus = engine::EventBus::instance();
+            m.time([&] {
+                for (std::uint64_t i = 0; i < n; ++i) bus.publish(topic, BenchClick{0, "1. Spawn Entity"});
+            });
+            return n;
+        });
+        runner.add("engine/EventBus::publishAsync/slowHandler", [topic](Measure& m) -> std::uint64_t {
+            const std::uint64_t n = 2'000;
+            auto& bus = engine::EventBus::instance();
+            bus.startAsync(engine::AsyncConfig{4096, 1, engine::AsyncPolicy::DropOldest});
+            m.time([&] {
+                for (std::uint64_t i = 0; i < n; ++i) bus.publishAsync(topic, BenchClick{0, "1. Spawn Entity"});
+            });
+            bus.stopAsync();
+            return n;
+        });
+    }
+
+    runner.add("engine/SharedState::pushConsole/1thread", [](Measure& m) -> std::uint64_t {
+        const std::uint64_t n = 100'000;
+        SharedState state;
+        m.time([&] {
+            for (std::uint64_t i = 0; i < n; ++i) state.pushConsole("[click] 1. Spawn Entity");
+        });
+        return n;
+    });
+
+    // Produtores empurrando linhas enquanto a thread de render tira snapshots sem parar
+    for (unsigned producers : {1u, 4u}) {
+        runner.add("engine/SharedState::pushConsole/contended/producers=" + std::to_string(producers),
+            [producers](Measure& m) -> std::uint64_t {
+                const std::uint64_t perThread = 50'000;
+                SharedState state;
+                std::atomic<bool> stop{false};
+                std::thread reader([&] {
+                    ConsoleSnapshot snap;
+                    while (!stop.load(std::memory_order_relaxed)) {
+                        state.snapshotConsole(snap, 6);
+                        if (snap.lines.size() > 1'000'000) std::printf("!");
+                    }
+                });
+                m.time([&] {
+                    std::vector<std::thread> threads;
+                    for (unsigned t = 0; t < producers; ++t) {
+                        threads.emplace_back([&] {
+                            for (std::uint64_t i = 0; i < perThread; ++i) state.pushConsole("[log] gerando codigo...");
+                        });
+                    }
+                    for (auto& t : threads) t.join();
+                });
+                stop = true;
+                reader.join();
+                return perThread * producers;
+            });
+    }
+
+    // Render a 60 FPS sem log novo: só compara a versão
+    runner.add("engine/SharedState::snapshotConsole/unchanged", [](Measure& m) -> std::uint64_t {
+        const std::uint64_t n = 10'000;
+        SharedState state;
+        for (int i = 0; i < 100; ++i) state.pushConsole("[click] linha de console com algum texto");
+        ConsoleSnapshot snap;
+        state.snapshotConsole(snap);
+        m.time([&] {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                if (state.snapshotConsole(snap)) std::printf("!");
+            }
+        });
+        return n;
+    });
+
+    // Cópia forçada das 100 linhas a cada chamada
+    runner.add("engine/SharedState::snapshotConsole/full", [](Measure& m) -> std::uint64_t {
+        const std::uint64_t n = 10'000;
+        SharedState state;
+        for (int i = 0; i < 100; ++i) state.pushConsole("[click] linha de console com algum texto");
+        ConsoleSnapshot snap;
+        m.time([&] {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                snap.version = 0;
+                state.snapshotConsole(snap);
+                if (snap.lines.empty()) std::printf("!");
+            }
+        });
+        return n;
+    });
+
+    // Render copiando as linhas visíveis enquanto outra thread loga sem parar
+    runner.add("engine/SharedState::snapshotConsole/contended", [](Measure& m) -> std::uint64_t {
+        const std::uint64_t n = 10'000;
+        SharedState state;
+        std::atomic<bool> stop{false};
+        std::thread writer([&] {
+            while (!stop.load(std::memory_order_relaxed)) state.pushConsole("[log] gerando codigo...");
+        });
+        ConsoleSnapshot snap;
+        m.time([&] {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                state.snapshotConsole(snap, 6);
+                if (snap.lines.size() > 1'000'000) std::printf("!");
+            }
+        });
+        stop = true;
+        writer.join();
+        return n;
+    });
+
+    // Console com 6 linhas visíveis e uma linha nova por frame.
+    // relayoutAll refaz o layout de todas, como o antigo setString por linha.
+    runner.add("engine/TextLayer::console/relayoutAll", [](Measure& m) -> std::uint64_t {
+        const std::uint64_t frames = 10'000;
+        MonoGlyphs glyphs;
+        std::vector<std::string> lines = consoleLines(frames + 6);
+        std::vector<UiVertex> verts;
+        m.time([&] {
+            for (std::uint64_t f = 0; f < frames; ++f) {
+                verts.clear();
+                for (std::size_t i = 0; i < 6; ++i) layoutLine(glyphs, lines[f + i], false, verts);
+                if (verts.empty()) std::printf("!");
+            }
+        });
+        return frames;
+    });
+
+    runner.add("engine/TextLayer::console/newLinePerFrame", [](Measure& m) -> std::uint64_t {
+        const std::uint64_t frames = 10'000;
+        MonoGlyphs glyphs;
+        TextLayer layer(glyphs);
+        std::vector<std::string> lines = consoleLines(frames + 6);
+        m.time([&] {
+            for (std::uint64_t f = 0; f < frames; ++f) {
+                layer.begin();
+                for (std::size_t i = 0; i < 6; ++i)
+                    layer.add(f + i, lines[f + i], 192.f, 598.f + 18.f * static_cast<float>(i), 0xDCDCFFFFu);
+                if (!layer.end()) std::printf("!");
+            }
+        });
+        return frames;
+    });
+
+    // Frame sem mudança: a UI redeclara as mesmas linhas e nada é remontado
+    runner.add("engine/TextLayer::console/unchanged", [](Measure& m) -> std::uint64_t {
+        const std::uint64_t frames = 10'000;
+        MonoGlyphs glyphs;
+        TextLayer layer(glyphs);
+        std::vector<std::string> lines = consoleLines(6);
+        m.time([&] {
+            for (std::uint64_t f = 0; f < frames; ++f) {
+                layer.begin();
+                for (std::size_t i = 0; i < 6; ++i)
+                    layer.add(i, lines[i], 192.f, 598.f + 18.f * static_cast<float>(i), 0xDCDCFFFFu);
+                if (layer.end() && f > 0) std::printf("!");
+            }
+        });
+        return frames;
+    });
+
+    // Ordenação por lote que a simulação faz ao publicar o snapshot
+    for (std::size_t n : {10'000u, 50'000u}) {
+        runner.add("engine/SpriteBatch::sortByBatchKey/n=" + std::to_string(n), [n](Measure& m) -> std::uint64_t {
+            const std::vector<RenderItem> source = previewItems(n);
+            std::vector<RenderItem> items, scratch;
+            items.reserve(n);
+            scratch.reserve(n);
+            const std::uint64_t reps = 20;
+            for (std::uint64_t r = 0; r < reps; ++r) {
+                items.assign(source.begin(), source.end());
+                m.time([&] { sortByBatchKey(items, scratch); });
+            }
+            return reps * n;
+        });
+    }
+
+    // Vértices de um frame do render: interpolação + 6 vértices por entidade + lotes
+    for (std::size_t n : {10'000u, 50'000u}) {
+        runner.add("engine/SpriteBatch::build/n=" + std::to_string(n), [n](Measure& m) -> std::uint64_t {
+            std::vector<RenderItem> items = previewItems(n), scratch;
+            sortByBatchKey(items, scratch);
+            std::vector<UiVertex> vertices;
+            std::vector<SpriteBatchRange> batches;
+            const std::uint64_t frames = 20;
+            m.time([&] {
+                for (std::uint64_t f = 0; f < frames; ++f) {
+                    buildSpriteBatches(items, static_cast<float>(f) / frames, vertices, batches,
+                        [](float x, float y, std::uint32_t color, float u, float v) {
+                            return UiVertex{x, y, color, u, v};
+                        });
+                    if (batches.size() != 6) std::printf("!");
+                }
+            });
+            return frames * n;
+        });
+    }
+}
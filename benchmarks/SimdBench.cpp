@@ -0,0 +1,53 @@
+// Kernels em lote (SimdKernels.h) contra o caminho escalar.
+// O backend vetorial depende das flags: -mavx2 → avx2, padrão x86-64 → sse2.
+#include "Bench.hpp"
+#include "../ecs-example/ECS.h"
+#include "../ecs-example/Components.h"
+#include "../ecs-example/SimdKernels.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+void bench::registerSimd(Runner& runner) {
+    const std::size_t n = 1'000'000;
+
+    struct Data {
+        ECS ecs;
+        std::vector<int> damage;
+        std::vector<std::uint32_t> dead;
+        int sign = 1;  // alterna o dano uniforme para manter a vida estável
+    };
+    auto data = std::make_shared<Data>();
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, 200);
+    for (std::size_t i = 0; i < n; ++i) {
+        EntityID e = data->ecs.createEntity();
+        data->ecs.addComponent(e, HealthComponent{200, dist(rng)});
+        data->ecs.addComponent(e, EnergyComponent{100, dist(rng)});
+    }
+    data->damage.resize(n);
+    for (auto& d : data->damage) d = dist(rng) % 7 - 3;
+    data->dead.reserve(n);
+
+    auto add = [&](const std::string& name, auto fn) {
+        runner.add(std::string("simd/") + name, [data, fn](Measure& m) -> std::uint64_t {
+            auto hp = data->ecs.components<HealthComponent>();
+            auto en = data->ecs.components<EnergyComponent>();
+            m.time([&] { fn(*data, hp, en); });
+            return n;
+        });
+    };
+
+    using HP = ComponentSpan<HealthComponent>;
+    using EN = ComponentSpan<EnergyComponent>;
+    const std::string simd = kernels::backend();
+
+    add("applyDamage/scalar", [](Data& d, HP hp, EN) { kernels::scalar::applyDamage(hp.data, d.damage.data(), hp.size); });
+    add("applyDamage/" + simd, [](Data& d, HP hp, EN) { kernels::applyDamage(hp.data, d.damage.data(), hp.size); });
+    add("applyUniformDamage/scalar", [](Data& d, HP hp, EN) { kernels::scalar::applyUniformDamage(hp.data, hp.size, d.sign = -d.sign); });
+    add("applyUniformDamage/" + simd, [](Data& d, HP hp, EN) { kernels::applyUniformDamage(hp.data, hp.size, d.sign = -d.sign); });
+    add("clampEnergy/scalar", [](Data&, HP, EN en) { kernels::scalar::clampEnergy(en.data, en.size); });
+    add("clampEnergy/" + simd, [](Data&, HP, EN en) { kernels::clampEnergy(en.data, en.size); });
+    add("findDead/scalar", [](Data& d, HP hp, EN) { d.dead.clear(); kernels::scalar::findDead(hp.data, hp.size, d.dead); });
+    add("findDead/" + simd, [](Data& d, HP hp, EN) { d.dead.clear(); kernels::findDead(hp.data, hp.size, d.dead); });
+}
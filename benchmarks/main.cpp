@@ -0,0 +1,109 @@
+// ============================================================
+//  Suíte de benchmarks (ECS, EventBus de combate, EventBus da
+//  engine, SharedState e kernels SIMD)
+//
+//  Build (sem SFML; só headers do projeto):
+//    cmake -S benchmarks -B build/bench && cmake --build build/bench
+//    (-DBENCH_AVX2=ON para medir o caminho AVX2)
+//  ou direto:
+//    g++ -std=c++17 -O2 -pthread benchmarks/*.cpp -o build/bench
+//
+//  Uso:
+//    bench [--filter texto] [--json saida.jsonl]
+//          [--baseline anterior.jsonl] [--tolerance 0.10]
+//          [--min-time segundos]
+//
+//  Com --baseline, casos mais lentos que a tolerância são
+//  listados e o processo sai com código 1.
+// ============================================================
+#include "Bench.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace {
+    std::atomic<std::uint64_t> g_allocs{0};
+    std::atomic<std::uint64_t> g_bytes{0};
+}
+
+std::uint64_t bench::allocationCount() { return g_allocs.load(std::memory_order_relaxed); }
+std::uint64_t bench::allocatedBytes() { return g_bytes.load(std::memory_order_relaxed); }
+
+void* operator new(std::size_t n) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(n, std::memory_order_relaxed);
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t n) {
+    return operator new(n);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+// Versões alinhadas (usadas por std::pmr::new_delete_resource): guarda o ponteiro
+// original logo antes do bloco alinhado, já que aligned_alloc não existe no MinGW
+void* operator new(std::size_t n, std::align_val_t al) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(n, std::memory_order_relaxed);
+    std::size_t a = static_cast<std::size_t>(al);
+    void* raw = std::malloc(n + a + sizeof(void*));
+    if (!raw) throw std::bad_alloc();
+    auto addr = (reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*) + a - 1) & ~(a - 1);
+    reinterpret_cast<void**>(addr)[-1] = raw;
+    return reinterpret_cast<void*>(addr);
+}
+
+void* operator new[](std::size_t n, std::align_val_t al) {
+    return operator new(n, al);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    if (p) std::free(static_cast<void**>(p)[-1]);
+}
+void operator delete[](void* p, std::align_val_t al) noexcept { operator delete(p, al); }
+void operator delete(void* p, std::size_t, std::align_val_t al) noexcept { operator delete(p, al); }
+void operator delete[](void* p, std::size_t, std::align_val_t al) noexcept { operator delete(p, al); }
+
+int main(int argc, char** argv) {
+    bench::Runner runner;
+    std::string jsonPath;
+    std::string baselinePath;
+    double tolerance = 0.10;
+
+    for (int i = 1; i < argc; ++i) {
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : ""; };
+        if (!std::strcmp(argv[i], "--filter")) runner.filter = next();
+        else if (!std::strcmp(argv[i], "--json")) jsonPath = next();
+        else if (!std::strcmp(argv[i], "--baseline")) baselinePath = next();
+        else if (!std::strcmp(argv[i], "--tolerance")) tolerance = std::atof(next());
+        else if (!std::strcmp(argv[i], "--min-time")) runner.minSeconds = std::atof(next());
+        else {
+            std::fprintf(stderr, "argumento desconhecido: %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    bench::registerEcs(runner);
+    bench::registerCombatEvents(runner);
+    bench::registerEngine(runner);
+    bench::registerSimd(runner);
+
+    auto results = runner.run();
+
+    if (!jsonPath.empty() && !bench::writeJson(jsonPath, results)) {
+        std::fprintf(stderr, "falha ao gravar %s\n", jsonPath.c_str());
+        return 2;
+    }
+    if (!baselinePath.empty()) {
+        auto baseline = bench::readJson(baselinePath);
+        if (bench::compare(results, baseline, tolerance) > 0) return 1;
+    }
+    return 0;
+}
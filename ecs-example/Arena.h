@@ -0,0 +1,150 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+// ============================================================
+//  Arena em chunks para o armazenamento dos pools
+//
+//  Blocos pequenos (até metade de um chunk) são arredondados para
+//  classes de potência de 2 e recortados de chunks grandes; blocos
+//  devolvidos vão para uma free list por classe e são reaproveitados
+//  quando um vector do pool cresce de novo. Blocos maiores vão
+//  direto ao upstream.
+//
+//  release() devolve tudo de uma vez — é o que ECS::clear() usa
+//  para limpar uma cena sem um free por componente.
+//
+//  Não é thread-safe: os pools só alocam em mudanças estruturais,
+//  que já são seriais (CommandBuffers::apply).
+// ============================================================
+
+class ChunkArena : public std::pmr::memory_resource {
+public:
+    struct Stats {
+        std::size_t reserved = 0;  // bytes pedidos ao upstream
+        std::size_t inUse = 0;     // bytes entregues e ainda não devolvidos
+        std::size_t freeListed = 0;  // bytes em free lists, prontos para reuso
+
+        // Fração reservada que não está em uso (free lists + sobras de chunk)
+        double fragmentation() const {
+            return reserved ? 1.0 - static_cast<double>(inUse) / static_cast<double>(reserved) : 0.0;
+        }
+    };
+
+    explicit ChunkArena(std::size_t chunkSize = 1 << 20,
+                        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : chunkSize(std::max<std::size_t>(chunkSize, std::size_t(1) << MIN_CLASS)), upstream(upstream) {}
+
+    ~ChunkArena() override { release(); }
+
+    ChunkArena(const ChunkArena&) = delete;
+    ChunkArena& operator=(const ChunkArena&) = delete;
+
+    // Devolve todos os chunks e blocos grandes ao upstream
+    void release() {
+        for (auto& c : chunks) upstream->deallocate(c.first, c.second, alignof(std::max_align_t));
+        for (auto& b : large) upstream->deallocate(b.ptr, b.bytes, b.align);
+        chunks.clear();
+        large.clear();
+        std::fill(std::begin(freeLists), std::end(freeLists), nullptr);
+        cursor = nullptr;
+        remaining = 0;
+        counters = Stats{};
+    }
+
+    const Stats& stats() const { return counters; }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t align) override {
+        if (isLarge(bytes, align)) {
+            void* p = upstream->allocate(bytes, align);
+            large.push_back(LargeBlock{p, bytes, align});
+            counters.reserved += bytes;
+            counters.inUse += bytes;
+            return p;
+        }
+        unsigned cls = classOf(bytes);
+        std::size_t size = std::size_t(1) << cls;
+        counters.inUse += size;
+        if (FreeNode* node = freeLists[cls]) {
+            freeLists[cls] = node->next;
+            counters.freeListed -= size;
+            return node;
+        }
+        // Blocos de classe 2^k saem alinhados a min(2^k, alinhamento do chunk)
+        std::size_t a = std::min(size, alignof(std::max_align_t));
+        std::size_t pad = cursor ? (a - reinterpret_cast<std::uintptr_t>(cursor) % a) % a : 0;
+        if (!cursor || pad + size > remaining) {
+            cursor = static_cast<std::byte*>(upstream->allocate(chunkSize, alignof(std::max_align_t)));
+            chunks.emplace_back(cursor, chunkSize);
+            counters.reserved += chunkSize;
+            remaining = chunkSize;
+            pad = (a - reinterpret_cast<std::uintptr_t>(cursor) % a) % a;
+        }
+        std::byte* p = cursor + pad;
+        cursor = p + size;
+        remaining -= pad + size;
+        return p;
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+        if (isLarge(bytes, align)) {
+            auto it = std::find_if(large.begin(), large.end(), [p](const LargeBlock& b) { return b.ptr == p; });
+            if (it == large.end()) return;
+            upstream->deallocate(p, bytes, align);
+            counters.reserved -= bytes;
+            counters.inUse -= bytes;
+            *it = large.back();
+            large.pop_back();
+            return;
+        }
+        unsigned cls = classOf(bytes);
+        std::size_t size = std::size_t(1) << cls;
+        auto* node = static_cast<FreeNode*>(p);
+        node->next = freeLists[cls];
+        freeLists[cls] = node;
+        counters.inUse -= size;
+        counters.freeListed += size;
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+    struct LargeBlock {
+        void* ptr;
+        std::size_t bytes;
+        std::size_t align;
+    };
+
+    static constexpr unsigned MIN_CLASS = 6;  // 64 bytes
+    static constexpr unsigned MAX_CLASSES = 48;
+
+    // Blocos grandes ou superalinhados não passam pelas free lists
+    bool isLarge(std::size_t bytes, std::size_t align) const {
+        return bytes > chunkSize / 2 || align > alignof(std::max_align_t);
+    }
+
+    static unsigned classOf(std::size_t bytes) {
+        unsigned cls = MIN_CLASS;
+        while ((std::size_t(1) << cls) < bytes) ++cls;
+        return cls;
+    }
+
+    std::size_t chunkSize;
+    std::pmr::memory_resource* upstream;
+    std::vector<std::pair<std::byte*, std::size_t>> chunks;
+    std::vector<LargeBlock> large;
+    FreeNode* freeLists[MAX_CLASSES] = {};
+    std::byte* cursor = nullptr;
+    std::size_t remaining = 0;
+    Stats counters;
+};
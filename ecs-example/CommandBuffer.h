@@ -0,0 +1,198 @@
+#pragma once
+#include "ECS.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+// Entidade criada por um CommandBuffer; só recebe um EntityID real no apply()
+struct PendingEntity {
+    std::uint32_t slot;
+};
+
+class CommandBuffers;
+
+// Grava mudanças estruturais (create/destroy/add/remove) durante a execução
+// dos systems. Nada toca o mundo até CommandBuffers::apply().
+class CommandBuffer {
+public:
+    PendingEntity createEntity() {
+        ++recorded;
+        return PendingEntity{pendingCount++};
+    }
+
+    void destroyEntity(EntityID id) {
+        ++recorded;
+        destroys.push_back(id);
+    }
+
+    template<typename Comp>
+    void addComponent(EntityID id, Comp comp) {
+        ++recorded;
+        staged<Comp>().adds.push_back({Target{id, false}, std::move(comp)});
+    }
+
+    template<typename Comp>
+    void addComponent(PendingEntity e, Comp comp) {
+        ++recorded;
+        staged<Comp>().adds.push_back({Target{e.slot, true}, std::move(comp)});
+    }
+
+    template<typename Comp>
+    void removeComponent(EntityID id) {
+        ++recorded;
+        staged<Comp>().removes.push_back(id);
+    }
+
+    bool empty() const {
+        return recorded == 0;
+    }
+
+    // Mantém a capacidade dos vetores para o próximo frame
+    void clear() {
+        recorded = 0;
+        pendingCount = 0;
+        resolved.clear();
+        destroys.clear();
+        for (auto& op : ops) {
+            if (op) op->clear();
+        }
+    }
+
+private:
+    friend class CommandBuffers;
+
+    struct Target {
+        std::uint32_t value;
+        bool pending;
+    };
+
+    struct IStagedOps {
+        virtual ~IStagedOps() = default;
+        // Aplica as operações deste tipo vindas de todos os buffers de uma vez
+        virtual void apply(ECS& ecs, std::vector<CommandBuffer>& buffers, std::uint32_t type) = 0;
+        virtual bool empty() const = 0;
+        virtual void clear() = 0;
+    };
+
+    template<typename Comp>
+    struct StagedOps : IStagedOps {
+        std::vector<std::pair<Target, Comp>> adds;
+        std::vector<EntityID> removes;
+
+        bool empty() const override { return adds.empty() && removes.empty(); }
+
+        void clear() override {
+            adds.clear();
+            removes.clear();
+        }
+
+        void apply(ECS& ecs, std::vector<CommandBuffer>& buffers, std::uint32_t type) override {
+            std::vector<std::pair<EntityID, Comp>> merged;
+            std::vector<EntityID> removed;
+            for (auto& buf : buffers) {
+                if (type >= buf.ops.size() || !buf.ops[type]) continue;
+                auto& ops = static_cast<StagedOps<Comp>&>(*buf.ops[type]);
+                for (auto& [target, comp] : ops.adds) {
+                    EntityID id = target.pending ? buf.resolved[target.value] : target.value;
+                    merged.emplace_back(id, std::move(comp));
+                }
+                removed.insert(removed.end(), ops.removes.begin(), ops.removes.end());
+            }
+
+            // Ordem por índice: escritas sequenciais no sparse e no array denso.
+            // stable_sort preserva "última escrita vence" para a mesma entidade.
+            std::stable_sort(merged.begin(), merged.end(), [](const auto& a, const auto& b) {
+                return entityIndex(a.first) < entityIndex(b.first);
+            });
+            ecs.reserveComponents<Comp>(merged.size());
+            for (auto& [id, comp] : merged) {
+                if (ecs.isAlive(id)) ecs.addComponent(id, std::move(comp));
+            }
+
+            // EntityID tem a geração nos bits altos: ordena pelo índice, que é o
+            // que endereça o sparse
+            std::sort(removed.begin(), removed.end(), [](EntityID a, EntityID b) {
+                return entityIndex(a) < entityIndex(b);
+            });
+            for (EntityID id : removed) {
+                ecs.removeComponent<Comp>(id);
+            }
+        }
+    };
+
+    std::size_t recorded = 0;
+    std::uint32_t pendingCount = 0;
+    std::vector<EntityID> resolved;
+    std::vector<EntityID> destroys;
+    std::vector<std::unique_ptr<IStagedOps>> ops;
+
+    template<typename Comp>
+    StagedOps<Comp>& staged() {
+        std::uint32_t type = componentTypeID<Comp>();
+        if (type >= ops.size()) {
+            ops.resize(type + 1);
+        }
+        if (!ops[type]) {
+            ops[type] = std::make_unique<StagedOps<Comp>>();
+        }
+        return static_cast<StagedOps<Comp>&>(*ops[type]);
+    }
+};
+
+// Um CommandBuffer por thread (slots do ThreadPool + thread externa).
+// apply() é o ponto de sincronização: roda numa única thread, depois dos systems.
+class CommandBuffers {
+public:
+    explicit CommandBuffers(std::size_t slots) : buffers(slots) {}
+
+    CommandBuffer& local(const ThreadPool& pool) {
+        return buffers[pool.currentSlot()];
+    }
+
+    CommandBuffer& at(std::size_t slot) {
+        return buffers[slot];
+    }
+
+    // Ordem: criações → adds → removes → destroys, tudo agrupado por tipo
+    void apply(ECS& ecs) {
+        bool any = false;
+        for (auto& buf : buffers) any = any || !buf.empty();
+        if (!any) return;
+
+        for (auto& buf : buffers) {
+            buf.resolved.reserve(buf.pendingCount);
+            for (std::uint32_t i = 0; i < buf.pendingCount; ++i) {
+                buf.resolved.push_back(ecs.createEntity());
+            }
+        }
+
+        std::size_t types = 0;
+        for (auto& buf : buffers) types = std::max(types, buf.ops.size());
+        for (std::uint32_t type = 0; type < types; ++type) {
+            for (auto& buf : buffers) {
+                if (type < buf.ops.size() && buf.ops[type] && !buf.ops[type]->empty()) {
+                    buf.ops[type]->apply(ecs, buffers, type);
+                    break;
+                }
+            }
+        }
+
+        std::vector<EntityID> destroys;
+        for (auto& buf : buffers) {
+            destroys.insert(destroys.end(), buf.destroys.begin(), buf.destroys.end());
+        }
+        // Pelo índice, como os removes: generations/entityPos e os sparse em ordem
+        std::sort(destroys.begin(), destroys.end(), [](EntityID a, EntityID b) {
+            return entityIndex(a) < entityIndex(b);
+        });
+        for (EntityID id : destroys) {
+            ecs.destroyEntity(id);
+        }
+
+        for (auto& buf : buffers) buf.clear();
+    }
+
+private:
+    std::vector<CommandBuffer> buffers;
+};
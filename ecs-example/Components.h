@@ -1,8 +1,9 @@
 #pragma once
-#include <string>
+#include "StringPool.h"
 
+// Nome internado: entidades com o mesmo nome dividem o texto
 struct NameComponent {
-    std::string value;
+    InternedString value;
 };
 
 struct HealthComponent {
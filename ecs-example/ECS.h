@@ -1,48 +1,741 @@
 #pragma once
-#include <unordered_map>
 #include <vector>
-#include <typeindex>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <tuple>
 #include <memory>
+#include <mutex>
+#include <atomic>
 #include <cassert>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include "Arena.h"
 
-using EntityID = int;
+#if __has_include(<cxxabi.h>)
+    #include <cxxabi.h>
+    #include <cstdlib>
+#endif
 
+// EntityID = [geração:12 | índice:20]. O índice é reciclado via free list;
+// a geração muda a cada destroyEntity, invalidando handles antigos.
+using EntityID = std::uint32_t;
+
+constexpr std::uint32_t ENTITY_INDEX_BITS = 20;
+constexpr std::uint32_t ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+constexpr std::uint32_t ENTITY_GENERATION_MASK = (1u << (32 - ENTITY_INDEX_BITS)) - 1;
+constexpr EntityID NullEntity = UINT32_MAX;
+
+constexpr std::uint32_t entityIndex(EntityID id) { return id & ENTITY_INDEX_MASK; }
+constexpr std::uint32_t entityGeneration(EntityID id) { return id >> ENTITY_INDEX_BITS; }
+constexpr EntityID makeEntity(std::uint32_t index, std::uint32_t generation) {
+    return (generation << ENTITY_INDEX_BITS) | index;
+}
+
+namespace detail {
+    inline std::atomic<std::uint32_t> nextComponentTypeID{0};
+
+    template<typename Comp>
+    std::uint32_t typeID() {
+        static const std::uint32_t id = nextComponentTypeID.fetch_add(1);
+        return id;
+    }
+}
+
+// ID sequencial por tipo de componente, usado para indexar os pools de cada mundo.
+// Atribuído uma única vez por tipo (thread-safe); não depende de nenhum mundo.
+// `const T` e `T` compartilham o mesmo ID.
+template<typename Comp>
+std::uint32_t componentTypeID() {
+    return detail::typeID<std::remove_cv_t<Comp>>();
+}
+
+// Filtros de view: entidades cujo componente foi adicionado / alterado
+// depois do tick `since` passado a ECS::view(). Entregam `const T&`.
+template<typename Comp>
+struct Added {};
+
+template<typename Comp>
+struct Changed {};
+
+namespace detail {
+    template<typename T> struct QueryTraits {
+        using Component = std::remove_const_t<T>;
+        using Ref = T&;
+        static constexpr bool mutates = !std::is_const_v<T>;
+        static constexpr int filter = 0;
+    };
+    template<typename T> struct QueryTraits<Added<T>> {
+        using Component = std::remove_const_t<T>;
+        using Ref = const Component&;
+        static constexpr bool mutates = false;
+        static constexpr int filter = 1;
+    };
+    template<typename T> struct QueryTraits<Changed<T>> {
+        using Component = std::remove_const_t<T>;
+        using Ref = const Component&;
+        static constexpr bool mutates = false;
+        static constexpr int filter = 2;
+    };
+}
+
+namespace detail {
+    // Garante espaço para `extra` elementos além dos atuais. Só realoca se
+    // faltar capacidade, e então ao menos dobra: reservar exatamente
+    // size() + extra a cada lote anularia o crescimento geométrico e
+    // deixaria lotes pequenos em sequência quadráticos.
+    template<typename Vec>
+    void reserveExtra(Vec& v, std::size_t extra) {
+        std::size_t needed = v.size() + extra;
+        if (v.capacity() < needed) v.reserve(std::max(needed, 2 * v.capacity()));
+    }
+
+    // Nome legível do tipo para relatórios (demangle no GCC/Clang)
+    inline std::string typeName(const std::type_info& type) {
+#if __has_include(<cxxabi.h>)
+        int status = 0;
+        char* name = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+        if (status == 0 && name) {
+            std::string out(name);
+            std::free(name);
+            return out;
+        }
+#endif
+        return type.name();
+    }
+}
+
+// Memória de um pool: todos os arrays paralelos (dense, owners, ticks, sparse)
+struct PoolMemory {
+    std::uint32_t type;
+    std::string name;
+    std::size_t count;
+    std::size_t bytesReserved;  // capacidade alocada
+    std::size_t bytesUsed;      // ocupada por componentes vivos
+
+    double fragmentation() const {
+        return bytesReserved ? 1.0 - static_cast<double>(bytesUsed) / static_cast<double>(bytesReserved) : 0.0;
+    }
+};
+
+class IComponentPool {
+public:
+    virtual ~IComponentPool() = default;
+    virtual void remove(EntityID id) = 0;
+    virtual bool has(EntityID id) const = 0;
+    virtual std::size_t size() const = 0;
+    virtual PoolMemory memory() const = 0;
+};
+
+// Acesso direto ao array denso de um pool (para kernels em lote).
+// data[i] pertence a entities[i].
+template<typename Comp>
+struct ComponentSpan {
+    Comp* data;
+    const EntityID* entities;
+    std::size_t size;
+};
+
+// Sparse set: componentes contíguos em `dense`, `sparse` mapeia entidade → índice.
+// Ponteiros devolvidos por get() valem até a próxima inserção/remoção no pool.
+// addedTicks/changedTicks acompanham `dense` e guardam o tick da última adição/alteração.
+// Todos os arrays alocam do memory_resource do mundo (ChunkArena por padrão).
+template<typename Comp>
+class ComponentPool : public IComponentPool {
+public:
+    static constexpr std::uint32_t npos = UINT32_MAX;
+
+    explicit ComponentPool(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : dense(resource), owners(resource), addedTicks(resource), changedTicks(resource), sparse(resource) {}
+
+    Comp& insert(EntityID id, Comp comp, std::uint32_t tick) {
+        std::uint32_t idx = entityIndex(id);
+        if (idx >= sparse.size()) {
+            sparse.resize(idx + 1, npos);
+        }
+        if (sparse[idx] != npos) {
+            std::uint32_t pos = sparse[idx];
+            touch(owners[pos]);
+            touch(id);
+            owners[pos] = id;
+            addedTicks[pos] = tick;
+            changedTicks[pos] = tick;
+            dense[pos] = std::move(comp);
+            return dense[pos];
+        }
+        touch(id);
+        sparse[idx] = static_cast<std::uint32_t>(dense.size());
+        owners.push_back(id);
+        addedTicks.push_back(tick);
+        changedTicks.push_back(tick);
+        dense.push_back(std::move(comp));
+        return dense.back();
+    }
+
+    Comp* get(EntityID id) {
+        std::uint32_t pos = find(id);
+        return pos != npos ? &dense[pos] : nullptr;
+    }
+
+    // Acesso mutável: marca o componente como alterado no tick atual
+    Comp* getMut(EntityID id, std::uint32_t tick) {
+        std::uint32_t pos = find(id);
+        if (pos == npos) return nullptr;
+        changedTicks[pos] = tick;
+        touch(id);
+        return &dense[pos];
+    }
+
+    Comp& at(std::uint32_t pos) { return dense[pos]; }
+    std::uint32_t addedTick(std::uint32_t pos) const { return addedTicks[pos]; }
+    std::uint32_t changedTick(std::uint32_t pos) const { return changedTicks[pos]; }
+    void markChanged(std::uint32_t pos, std::uint32_t tick) {
+        changedTicks[pos] = tick;
+        if (tracking) rescan.store(true, std::memory_order_relaxed);
+    }
+
+    void markAllChanged(std::uint32_t tick) {
+        std::fill(changedTicks.begin(), changedTicks.end(), tick);
+        if (tracking) rescan.store(true, std::memory_order_relaxed);
+    }
+
+    // Compara o ID completo: handles de gerações antigas não encontram nada
+    std::uint32_t find(EntityID id) const {
+        std::uint32_t idx = entityIndex(id);
+        if (idx < sparse.size()) {
+            std::uint32_t pos = sparse[idx];
+            if (pos != npos && owners[pos] == id) return pos;
+        }
+        return npos;
+    }
+
+    bool has(EntityID id) const override {
+        return find(id) != npos;
+    }
+
+    // Remove trocando com o último elemento para manter o array denso
+    void remove(EntityID id) override {
+        std::uint32_t pos = find(id);
+        if (pos == npos) return;
+        touch(id);
+        std::uint32_t last = static_cast<std::uint32_t>(dense.size() - 1);
+        if (pos != last) {
+            dense[pos] = std::move(dense[last]);
+            owners[pos] = owners[last];
+            addedTicks[pos] = addedTicks[last];
+            changedTicks[pos] = changedTicks[last];
+            sparse[entityIndex(owners[pos])] = pos;
+        }
+        dense.pop_back();
+        owners.pop_back();
+        addedTicks.pop_back();
+        changedTicks.pop_back();
+        sparse[entityIndex(id)] = npos;
+    }
+
+    std::size_t size() const override { return dense.size(); }
+
+    PoolMemory memory() const override {
+        constexpr std::size_t perEntity = sizeof(Comp) + sizeof(EntityID) + 2 * sizeof(std::uint32_t);
+        return PoolMemory{
+            componentTypeID<Comp>(),
+            detail::typeName(typeid(Comp)),
+            dense.size(),
+            dense.capacity() * sizeof(Comp) + owners.capacity() * sizeof(EntityID)
+                + (addedTicks.capacity() + changedTicks.capacity() + sparse.capacity()) * sizeof(std::uint32_t),
+            dense.size() * perEntity + sparse.size() * sizeof(std::uint32_t)};
+    }
+
+    // Espaço para `extra` componentes além dos atuais (ver detail::reserveExtra)
+    void reserveExtra(std::size_t extra) {
+        detail::reserveExtra(dense, extra);
+        detail::reserveExtra(owners, extra);
+        detail::reserveExtra(addedTicks, extra);
+        detail::reserveExtra(changedTicks, extra);
+    }
+    // Insere a mesma cópia de `proto` para `count` entidades novas (sem componente
+    // neste pool) num único passe contíguo por array
+    void insertFill(const EntityID* ids, std::size_t count, const Comp& proto, std::uint32_t tick) {
+        if (count == 0) return;
+        std::uint32_t maxIndex = 0;
+        for (std::size_t i = 0; i < count; ++i) maxIndex = std::max(maxIndex, entityIndex(ids[i]));
+        if (maxIndex >= sparse.size()) sparse.resize(maxIndex + 1, npos);
+
+        std::uint32_t base = static_cast<std::uint32_t>(dense.size());
+        for (std::size_t i = 0; i < count; ++i) {
+            assert(sparse[entityIndex(ids[i])] == npos);
+            sparse[entityIndex(ids[i])] = base + static_cast<std::uint32_t>(i);
+        }
+        owners.insert(owners.end(), ids, ids + count);
+        addedTicks.insert(addedTicks.end(), count, tick);
+        changedTicks.insert(changedTicks.end(), count, tick);
+        dense.insert(dense.end(), count, proto);
+        // ticks novos: a próxima sincronização de índice encontra essas entidades
+        if (tracking) rescan.store(true, std::memory_order_relaxed);
+    }
+
+    Comp* data() { return dense.data(); }
+    const Comp* data() const { return dense.data(); }
+    const std::pmr::vector<EntityID>& entities() const { return owners; }
+    const std::pmr::vector<std::uint32_t>& sparseTable() const { return sparse; }
+
+    // Substitui todo o conteúdo por arrays prontos (carga de snapshot);
+    // make(i) produz o i-ésimo componente
+    template<typename Make>
+    void assign(const EntityID* ids, std::size_t count,
+                const std::uint32_t* sparseData, std::size_t sparseSize,
+                std::uint32_t tick, Make&& make) {
+        owners.assign(ids, ids + count);
+        sparse.assign(sparseData, sparseData + sparseSize);
+        addedTicks.assign(count, tick);
+        changedTicks.assign(count, tick);
+        dense.clear();
+        dense.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) dense.push_back(make(i));
+    }
+
+    // Versão para tipos trivialmente copiáveis: uma cópia de bloco, sem laço por entidade
+    void assignRaw(const EntityID* ids, const Comp* values, std::size_t count,
+                   const std::uint32_t* sparseData, std::size_t sparseSize, std::uint32_t tick) {
+        static_assert(std::is_trivially_copyable_v<Comp>);
+        owners.assign(ids, ids + count);
+        sparse.assign(sparseData, sparseData + sparseSize);
+        addedTicks.assign(count, tick);
+        changedTicks.assign(count, tick);
+        dense.assign(values, values + count);
+    }
+
+    // Registro de alterações para índices secundários (FieldIndex.h); desligado até o
+    // primeiro índice sobre este pool. insert/remove/getMut anotam a entidade;
+    // markChanged só levanta `rescan` (pode rodar em paralelo dentro de views).
+    struct Touched {
+        std::vector<EntityID> ids;
+        bool rescan = false;   // revisitar posições com changedTick recente
+        bool rebuild = false;  // log estourou: reconstruir do zero
+    };
+
+    void enableTracking() { tracking = true; }
+
+    void takeTouched(Touched& out) {
+        std::lock_guard<std::mutex> lock(touchedMutex);
+        out.ids.swap(touched);
+        touched.clear();
+        out.rescan = rescan.exchange(false, std::memory_order_relaxed);
+        out.rebuild = overflowed;
+        overflowed = false;
+    }
+
+private:
+    std::pmr::vector<Comp> dense;
+    std::pmr::vector<EntityID> owners;
+    std::pmr::vector<std::uint32_t> addedTicks;
+    std::pmr::vector<std::uint32_t> changedTicks;
+    std::pmr::vector<std::uint32_t> sparse;
+
+    bool tracking = false;
+    bool overflowed = false;
+    std::atomic<bool> rescan{false};
+    std::mutex touchedMutex;
+    std::vector<EntityID> touched;
+
+    // getComponent<T> pode vir de workers diferentes, daí o mutex
+    void touch(EntityID id) {
+        if (!tracking) return;
+        std::lock_guard<std::mutex> lock(touchedMutex);
+        if (overflowed) return;
+        if (touched.size() > dense.size()) {
+            overflowed = true;
+            touched.clear();
+            return;
+        }
+        touched.push_back(id);
+    }
+};
+
+// Itera apenas entidades que possuem todos os componentes listados.
+// A iteração é guiada pelo menor pool; não adicione/remova componentes dentro de each().
+//   T         → T&, marca como alterado
+//   const T   → const T&, só leitura
+//   Added<T>  / Changed<T> → const T&, filtra por tick > since
+template<typename... Comps>
+class View {
+    template<typename Q>
+    using PoolOf = ComponentPool<typename detail::QueryTraits<Q>::Component>;
+
+public:
+    View(std::uint32_t since, std::uint32_t tick, PoolOf<Comps>&... ps)
+        : pools(&ps...), since(since), tick(tick) {}
+
+    template<typename Func>
+    void each(Func&& fn) {
+        each(0, sizeHint(), fn);
+    }
+
+    // Visita apenas as posições [first, last) do pool guia; permite dividir a view entre workers
+    template<typename Func>
+    void each(std::size_t first, std::size_t last, Func&& fn) {
+        eachImpl(first, last, fn, std::index_sequence_for<Comps...>{});
+    }
+
+    // Limite superior de entidades visitadas
+    std::size_t sizeHint() const {
+        return smallest()->size();
+    }
+
+private:
+    std::tuple<PoolOf<Comps>*...> pools;
+    std::uint32_t since;
+    std::uint32_t tick;
+
+    template<std::size_t I>
+    using QueryAt = std::tuple_element_t<I, std::tuple<Comps...>>;
+
+    template<std::size_t I>
+    bool passes(std::uint32_t pos) const {
+        using Traits = detail::QueryTraits<QueryAt<I>>;
+        const auto* pool = std::get<I>(pools);
+        if constexpr (Traits::filter == 1) return pool->addedTick(pos) > since;
+        else if constexpr (Traits::filter == 2) return pool->changedTick(pos) > since;
+        else return true;
+    }
+
+    template<std::size_t I>
+    typename detail::QueryTraits<QueryAt<I>>::Ref fetch(std::uint32_t pos) {
+        auto* pool = std::get<I>(pools);
+        if constexpr (detail::QueryTraits<QueryAt<I>>::mutates) pool->markChanged(pos, tick);
+        return pool->at(pos);
+    }
+
+    template<typename Func, std::size_t... I>
+    void eachImpl(std::size_t first, std::size_t last, Func& fn, std::index_sequence<I...>) {
+        const std::pmr::vector<EntityID>& driver = *smallest();
+        last = std::min(last, driver.size());
+        std::uint32_t pos[sizeof...(Comps)];
+        for (std::size_t i = first; i < last; ++i) {
+            EntityID id = driver[i];
+            if ((((pos[I] = std::get<I>(pools)->find(id)) != PoolOf<QueryAt<I>>::npos) && ...)
+                && (passes<I>(pos[I]) && ...)) {
+                fn(id, fetch<I>(pos[I])...);
+            }
+        }
+    }
+
+    const std::pmr::vector<EntityID>* smallest() const {
+        return smallestImpl(std::index_sequence_for<Comps...>{});
+    }
+
+    template<std::size_t... I>
+    const std::pmr::vector<EntityID>* smallestImpl(std::index_sequence<I...>) const {
+        const std::pmr::vector<EntityID>* best = nullptr;
+        ((best = (!best || std::get<I>(pools)->size() < best->size())
+                     ? &std::get<I>(pools)->entities()
+                     : best), ...);
+        return best;
+    }
+};
+
+// Relógio de mudanças. Atômico porque systems paralelos avançam o tick ao começar
+// (ChangeCursor) enquanto outros carimbam escritas; movível junto com o mundo.
+class ChangeClock {
+public:
+    ChangeClock() = default;
+    ChangeClock(ChangeClock&& o) noexcept : value(o.value.load()) {}
+    ChangeClock& operator=(ChangeClock&& o) noexcept {
+        value.store(o.value.load());
+        return *this;
+    }
+
+    std::uint32_t now() const { return value.load(std::memory_order_acquire); }
+    std::uint32_t advance() { return value.fetch_add(1, std::memory_order_acq_rel); }
+
+private:
+    // Começa em 1: um leitor com since = 0 vê tudo que já existe
+    std::atomic<std::uint32_t> value{1};
+};
+
+class WorldSnapshot;
+class Prefab;
+
+// Índice secundário sobre um campo de componente; definido em FieldIndex.h
+template<auto Member>
+class FieldIndex;
+
+class IFieldIndex {
+public:
+    virtual ~IFieldIndex() = default;
+    // Descarta o conteúdo; o próximo acesso reconstrói a partir do pool
+    virtual void invalidate() = 0;
+};
+
+namespace detail {
+    template<auto Member>
+    inline constexpr char fieldIndexTag = 0;
+}
+
+// Cada ECS é um mundo independente: entidades e pools pertencem à instância.
+// Mundos podem ser movidos (não copiados) e usados em threads diferentes sem
+// estado mutável compartilhado — um mundo por thread, sem locks.
 class ECS {
 public:
+    // Cada mundo aloca seus pools numa ChunkArena própria; passe outro
+    // memory_resource (ex.: std::pmr::new_delete_resource()) para trocar o backend
+    ECS() : arena(std::make_unique<ChunkArena>()), resource(arena.get()) {}
+    explicit ECS(std::pmr::memory_resource* resource) : resource(resource) {}
+
+    ECS(ECS&& o) noexcept
+        : entities(std::move(o.entities)), generations(std::move(o.generations)),
+          entityPos(std::move(o.entityPos)), freeList(std::move(o.freeList)),
+          arena(std::move(o.arena)), resource(o.resource), pools(std::move(o.pools)),
+          indexes(std::move(o.indexes)), clock(std::move(o.clock)) {
+        o.resource = std::pmr::get_default_resource();
+    }
+
+    // Os pools antigos precisam morrer antes da arena que os alimenta
+    ECS& operator=(ECS&& o) noexcept {
+        if (this == &o) return *this;
+        indexes.clear();
+        pools.clear();
+        entities = std::move(o.entities);
+        generations = std::move(o.generations);
+        entityPos = std::move(o.entityPos);
+        freeList = std::move(o.freeList);
+        arena = std::move(o.arena);
+        resource = o.resource;
+        pools = std::move(o.pools);
+        indexes = std::move(o.indexes);
+        clock = std::move(o.clock);
+        o.resource = std::pmr::get_default_resource();
+        return *this;
+    }
+
+    ECS(const ECS&) = delete;
+    ECS& operator=(const ECS&) = delete;
+
     EntityID createEntity() {
-        EntityID id = nextID++;
+        std::uint32_t index;
+        if (!freeList.empty()) {
+            index = freeList.back();
+            freeList.pop_back();
+        } else {
+            index = static_cast<std::uint32_t>(generations.size());
+            assert(index <= ENTITY_INDEX_MASK && "limite de entidades atingido");
+            generations.push_back(0);
+            entityPos.push_back(DEAD);
+        }
+        EntityID id = makeEntity(index, generations[index]);
+        entityPos[index] = static_cast<std::uint32_t>(entities.size());
         entities.push_back(id);
         return id;
     }
 
+    // Cria `n` entidades de uma vez (índices da free list primeiro) e devolve os IDs
+    std::vector<EntityID> createEntities(std::size_t n) {
+        std::vector<EntityID> ids(n);
+        std::size_t reused = std::min(n, freeList.size());
+        std::size_t fresh = n - reused;
+        assert(generations.size() + fresh <= std::size_t(ENTITY_INDEX_MASK) + 1 && "limite de entidades atingido");
+        detail::reserveExtra(entities, n);
+        detail::reserveExtra(generations, fresh);
+        detail::reserveExtra(entityPos, fresh);
+        for (std::size_t i = 0; i < n; ++i) {
+            std::uint32_t index;
+            if (i < reused) {
+                index = freeList.back();
+                freeList.pop_back();
+            } else {
+                index = static_cast<std::uint32_t>(generations.size());
+                generations.push_back(0);
+                entityPos.push_back(DEAD);
+            }
+            ids[i] = makeEntity(index, generations[index]);
+            entityPos[index] = static_cast<std::uint32_t>(entities.size());
+            entities.push_back(ids[i]);
+        }
+        return ids;
+    }
+
+    // Cria `n` cópias de um prefab (definido em Prefab.h)
+    std::vector<EntityID> createEntities(std::size_t n, const Prefab& prefab);
+
+    // Remove todos os componentes, recicla o índice e invalida o handle
+    bool destroyEntity(EntityID id) {
+        if (!isAlive(id)) return false;
+        for (auto& pool : pools) {
+            if (pool) pool->remove(id);
+        }
+        std::uint32_t index = entityIndex(id);
+        std::uint32_t pos = entityPos[index];
+        EntityID last = entities.back();
+        entities[pos] = last;
+        entityPos[entityIndex(last)] = pos;
+        entities.pop_back();
+        entityPos[index] = DEAD;
+        generations[index] = (generations[index] + 1) & ENTITY_GENERATION_MASK;
+        freeList.push_back(index);
+        return true;
+    }
+
+    // Destrói todas as entidades de uma vez: os pools são descartados inteiros e a
+    // arena devolve seus chunks em bloco. Handles antigos continuam inválidos.
+    void clear() {
+        for (auto& entry : indexes) entry.second->invalidate();
+        pools.clear();
+        if (arena) arena->release();
+        for (EntityID id : entities) {
+            std::uint32_t index = entityIndex(id);
+            generations[index] = (generations[index] + 1) & ENTITY_GENERATION_MASK;
+            entityPos[index] = DEAD;
+            freeList.push_back(index);
+        }
+        entities.clear();
+    }
+
+    bool isAlive(EntityID id) const {
+        std::uint32_t index = entityIndex(id);
+        return index < generations.size()
+            && entityPos[index] != DEAD
+            && generations[index] == entityGeneration(id);
+    }
+
+    // Lista densa das entidades vivas (ordem muda após destroyEntity)
     const std::vector<EntityID>& getEntities() const {
         return entities;
     }
 
     template<typename Comp>
-    void addComponent(EntityID id, Comp comp) {
-        auto type = std::type_index(typeid(Comp));
-        auto& map = getComponentMap<Comp>();
-        map[id] = std::make_shared<Comp>(comp);
+    Comp& addComponent(EntityID id, Comp comp) {
+        assert(isAlive(id));
+        return getPool<Comp>().insert(id, std::move(comp), clock.now());
     }
 
+    // getComponent<T> marca o componente como alterado; getComponent<const T> só lê
     template<typename Comp>
-    std::shared_ptr<Comp> getComponent(EntityID id) {
-        auto& map = getComponentMap<Comp>();
-        auto it = map.find(id);
-        if (it != map.end()) {
-            return std::static_pointer_cast<Comp>(it->second);
+    Comp* getComponent(EntityID id) {
+        if constexpr (std::is_const_v<Comp>) {
+            return getPool<Comp>().get(id);
+        } else {
+            return getPool<Comp>().getMut(id, clock.now());
         }
-        return nullptr;
     }
 
+    // Reserva espaço para `extra` componentes além dos atuais; só realoca
+    // (ao menos dobrando) se a capacidade não bastar
+    template<typename Comp>
+    void reserveComponents(std::size_t extra) {
+        getPool<Comp>().reserveExtra(extra);
+    }
+
+    // components<T> marca o pool inteiro como alterado; components<const T> só lê
+    template<typename Comp>
+    ComponentSpan<Comp> components() {
+        auto& pool = getPool<Comp>();
+        if constexpr (!std::is_const_v<Comp>) pool.markAllChanged(clock.now());
+        return ComponentSpan<Comp>{pool.data(), pool.entities().data(), pool.size()};
+    }
+
+    template<typename Comp>
+    void removeComponent(EntityID id) {
+        getPool<Comp>().remove(id);
+    }
+
+    template<typename Comp>
+    bool hasComponent(EntityID id) {
+        return getPool<Comp>().has(id);
+    }
+
+    // Garante que o pool exista; necessário antes de rodar systems em paralelo,
+    // já que a criação lazy de pools altera o mundo
+    template<typename Comp>
+    void registerComponent() {
+        getPool<Comp>();
+    }
+
+    template<typename... Comps>
+    View<Comps...> view(std::uint32_t since = 0) {
+        static_assert(sizeof...(Comps) > 0, "view<> precisa de ao menos um componente");
+        return View<Comps...>(since, clock.now(),
+                              getPool<typename detail::QueryTraits<Comps>::Component>()...);
+    }
+
+    // Índice ordenado sobre um campo, criado no primeiro uso e sincronizado a cada
+    // chamada (requer FieldIndex.h; só compensa a partir de ~100k entidades):
+    //   ecs.index<&HealthComponent::currentHP>().atMost(0)
+    template<auto Member>
+    const FieldIndex<Member>& index() {
+        using Index = FieldIndex<Member>;
+        Index* found = nullptr;
+        for (auto& [tag, idx] : indexes) {
+            if (tag == &detail::fieldIndexTag<Member>) found = static_cast<Index*>(idx.get());
+        }
+        if (!found) {
+            auto created = std::make_unique<Index>();
+            found = created.get();
+            indexes.emplace_back(&detail::fieldIndexTag<Member>, std::move(created));
+        }
+        found->sync(getPool<typename Index::Component>(), clock.now());
+        return *found;
+    }
+
+    // Memória por tipo de componente, na ordem dos IDs de tipo
+    std::vector<PoolMemory> memoryReport() const {
+        std::vector<PoolMemory> out;
+        for (const auto& pool : pools) {
+            if (pool) out.push_back(pool->memory());
+        }
+        return out;
+    }
+
+    // Totais da arena do mundo (zerados quando o backend é externo)
+    ChunkArena::Stats arenaStats() const {
+        return arena ? arena->stats() : ChunkArena::Stats{};
+    }
+
+    std::uint32_t currentTick() const { return clock.now(); }
+
+    // Devolve o tick atual e avança o relógio: escritas feitas depois desta
+    // chamada recebem um tick maior que o devolvido
+    std::uint32_t advanceTick() { return clock.advance(); }
+
 private:
-    EntityID nextID = 0;
+    friend class WorldSnapshot;
+    friend class Prefab;
+
+    static constexpr std::uint32_t DEAD = UINT32_MAX;
+
     std::vector<EntityID> entities;
+    std::vector<std::uint32_t> generations;
+    std::vector<std::uint32_t> entityPos;
+    std::vector<std::uint32_t> freeList;
+    std::unique_ptr<ChunkArena> arena;
+    std::pmr::memory_resource* resource;
+    std::vector<std::unique_ptr<IComponentPool>> pools;
+    std::vector<std::pair<const void*, std::unique_ptr<IFieldIndex>>> indexes;
+    ChangeClock clock;
 
     template<typename Comp>
-    std::unordered_map<EntityID, std::shared_ptr<void>>& getComponentMap() {
-        static std::unordered_map<EntityID, std::shared_ptr<void>> map;
-        return map;
+    ComponentPool<std::remove_const_t<Comp>>& getPool() {
+        using Base = std::remove_const_t<Comp>;
+        std::uint32_t type = componentTypeID<Base>();
+        if (type >= pools.size()) {
+            pools.resize(type + 1);
+        }
+        if (!pools[type]) {
+            pools[type] = std::make_unique<ComponentPool<Base>>(resource);
+        }
+        return static_cast<ComponentPool<Base>&>(*pools[type]);
+    }
+};
+
+// Lembra até onde um leitor (system) já viu mudanças.
+//   auto since = cursor.begin(ecs);
+//   ecs.view<Changed<HealthComponent>>(since).each(...);
+struct ChangeCursor {
+    std::uint32_t last = 0;
+
+    std::uint32_t begin(ECS& ecs) {
+        std::uint32_t since = last;
+        last = ecs.advanceTick();
+        return since;
     }
 };
@@ -1,32 +1,148 @@
 #pragma once
-#include <functional>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
+#include "ECS.h"
 
-enum class EvtType {
-    Attack,
-    Defend,
-    Special
+// ============================================================
+//  Eventos de combate tipados
+//
+//  Cada evento é um struct próprio com só os campos de que precisa.
+//  O EventBus recebe a lista de eventos e os handlers como parâmetros
+//  de template; quem trata o quê é resolvido em compilação:
+//
+//    struct MeuHandler {
+//        void on(const AttackEvent& e);                  // um por vez
+//        void onBatch(EventSpan<SpecialEvent> events);   // lote do flush
+//    };
+//    EventBus<CombatEvents, MeuHandler> bus(handler);
+//
+//  send(e) entrega na hora; post(e) enfileira e flush() entrega cada
+//  fila como um span contíguo. Não há std::function nem tabela
+//  indexada por enum: a chamada é direta e pode ser inlined.
+//
+//  post + flush serve para aplicar o turno de uma vez, na ordem da
+//  EventList, não para ganhar velocidade: no benchmark (100k ataques
+//  entre 1000 combatentes) sai ~10 ns/evento contra ~7 do send. Com
+//  o mundo no cache, somar por alvo não paga a cópia para a fila.
+// ============================================================
+
+struct AttackEvent {
+    EntityID source;
+    EntityID target;
+};
+
+struct DefendEvent {
+    EntityID source;
 };
 
-struct Event {
-    EvtType type;
-    int sourceID;
-    int targetID;
+struct SpecialEvent {
+    EntityID source;
+    EntityID target;
 };
 
-using EventCallback = std::function<void(const Event&)>;
+template<typename... Events>
+struct EventList {};
+
+// Eventos de combate, na ordem em que flush() os entrega
+using CombatEvents = EventList<AttackEvent, DefendEvent, SpecialEvent>;
+
+// Eventos contíguos de um mesmo tipo entregues de uma vez no flush()
+template<typename E>
+struct EventSpan {
+    const E* data;
+    std::size_t count;
+
+    const E* begin() const { return data; }
+    const E* end() const { return data + count; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+};
 
-class EventBus {
+namespace detail {
+    template<typename H, typename E, typename = void>
+    struct HandlesEvent : std::false_type {};
+    template<typename H, typename E>
+    struct HandlesEvent<H, E, std::void_t<decltype(std::declval<H&>().on(std::declval<const E&>()))>>
+        : std::true_type {};
+
+    template<typename H, typename E, typename = void>
+    struct HandlesBatch : std::false_type {};
+    template<typename H, typename E>
+    struct HandlesBatch<H, E, std::void_t<decltype(std::declval<H&>().onBatch(std::declval<EventSpan<E>>()))>>
+        : std::true_type {};
+
+    template<typename E, typename... Events>
+    constexpr bool listed = (std::is_same_v<E, Events> || ...);
+}
+
+template<typename List, typename... Handlers>
+class EventBus;
+
+// Handlers são guardados por referência e precisam viver mais que o bus
+template<typename... Events, typename... Handlers>
+class EventBus<EventList<Events...>, Handlers...> {
 public:
-    void subscribe(EvtType type, EventCallback cb) {
-        listeners[(int)type].push_back(cb);
+    explicit EventBus(Handlers&... handlers) : handlers(handlers...) {}
+
+    // Entrega imediata: on(e) ou, na falta dele, onBatch com um evento só
+    template<typename E>
+    void send(const E& e) {
+        static_assert(detail::listed<E, Events...>, "evento fora da EventList deste bus");
+        std::apply([&](Handlers&... hs) { (deliverOne(hs, e), ...); }, handlers);
     }
 
-    void send(const Event& e) {
-        for (auto &cb : listeners[(int)e.type]) {
-            cb(e);
-        }
+    template<typename E>
+    void post(const E& e) {
+        static_assert(detail::listed<E, Events...>, "evento fora da EventList deste bus");
+        std::get<Queue<E>>(queues).queued.push_back(e);
     }
+
+    // Entrega tudo que foi postado até aqui, na ordem da EventList.
+    // Eventos postados durante o flush ficam para o próximo.
+    void flush() {
+        (flushType<Events>(), ...);
+    }
+
+    std::size_t pending() const {
+        return (std::get<Queue<Events>>(queues).queued.size() + ... + std::size_t(0));
+    }
+
 private:
-    std::vector<EventCallback> listeners[3];
+    template<typename E>
+    struct Queue {
+        std::vector<E> queued;
+        std::vector<E> flushing;
+    };
+
+    std::tuple<Handlers&...> handlers;
+    std::tuple<Queue<Events>...> queues;
+
+    template<typename H, typename E>
+    static void deliverOne(H& h, const E& e) {
+        if constexpr (detail::HandlesEvent<H, E>::value) h.on(e);
+        else if constexpr (detail::HandlesBatch<H, E>::value) h.onBatch(EventSpan<E>{&e, 1});
+    }
+
+    template<typename H, typename E>
+    static void deliverBatch(H& h, EventSpan<E> batch) {
+        if constexpr (detail::HandlesBatch<H, E>::value) {
+            h.onBatch(batch);
+        } else if constexpr (detail::HandlesEvent<H, E>::value) {
+            for (const E& e : batch) h.on(e);
+        }
+    }
+
+    template<typename E>
+    void flushType() {
+        auto& q = std::get<Queue<E>>(queues);
+        if (q.queued.empty()) return;
+        // troca de buffer: handlers podem postar enquanto o lote é entregue
+        q.flushing.swap(q.queued);
+        EventSpan<E> batch{q.flushing.data(), q.flushing.size()};
+        std::apply([&](Handlers&... hs) { (deliverBatch(hs, batch), ...); }, handlers);
+        q.flushing.clear();
+    }
 };
@@ -0,0 +1,325 @@
+#pragma once
+#include "ECS.h"
+#include "Components.h"
+#include "Events.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// ============================================================
+//  Journal binário de eventos + replay determinístico
+//
+//  O EventJournal entra no EventBus como mais um handler e grava
+//  cada evento entregue, numa sequência append-only de varints:
+//
+//    "ECSJ" versão nTiposDeEvento
+//    registro = tag [payload]
+//      tag 0        → início de tick, delta do tick anterior
+//      tag 1        → checkpoint: hash de estado (8 bytes)
+//      tag 2 + i    → evento i da EventList, campos em varint
+//
+//  O replay posta os eventos de cada tick num bus novo, faz flush
+//  nas fronteiras de tick e compara o hash de estado em cada
+//  checkpoint — sem render, sem input, na velocidade da CPU.
+//
+//  Supõe o padrão post + flush por tick. Handlers que postam
+//  eventos derivados não devem estar no bus do replay: esses
+//  eventos também estão no journal e seriam entregues duas vezes.
+// ============================================================
+
+constexpr std::uint32_t JOURNAL_VERSION = 2;  // 2: hash de checkpoint por posição do pool
+
+// Campos gravados de cada evento; um evento novo precisa de uma especialização
+template<typename E>
+struct JournalFields;
+
+template<>
+struct JournalFields<AttackEvent> {
+    static constexpr auto members = std::make_tuple(&AttackEvent::source, &AttackEvent::target);
+};
+
+template<>
+struct JournalFields<DefendEvent> {
+    static constexpr auto members = std::make_tuple(&DefendEvent::source);
+};
+
+template<>
+struct JournalFields<SpecialEvent> {
+    static constexpr auto members = std::make_tuple(&SpecialEvent::source, &SpecialEvent::target);
+};
+
+namespace journal {
+
+    enum Tag : std::uint32_t {
+        TickTag = 0,
+        CheckpointTag = 1,
+        FirstEventTag = 2
+    };
+
+    inline void putVarint(std::vector<std::uint8_t>& out, std::uint64_t v) {
+        while (v >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(v));
+    }
+
+    struct Reader {
+        const std::uint8_t* p;
+        const std::uint8_t* end;
+        bool ok = true;
+
+        std::uint64_t varint() {
+            std::uint64_t v = 0;
+            for (unsigned shift = 0; shift < 64; shift += 7) {
+                if (p == end) break;
+                std::uint8_t b = *p++;
+                v |= std::uint64_t(b & 0x7F) << shift;
+                if (!(b & 0x80)) return v;
+            }
+            ok = false;
+            return 0;
+        }
+
+        std::uint64_t fixed64() {
+            if (end - p < 8) {
+                ok = false;
+                return 0;
+            }
+            std::uint64_t v = 0;
+            for (int i = 0; i < 8; ++i) v |= std::uint64_t(p[i]) << (8 * i);
+            p += 8;
+            return v;
+        }
+    };
+
+    // Inteiros com sinal em zigzag, para valores pequenos negativos caberem em 1 byte
+    template<typename T>
+    std::uint64_t encodeField(T v) {
+        static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "campos de evento no journal devem ser inteiros");
+        if constexpr (std::is_enum_v<T>) {
+            return encodeField(static_cast<std::underlying_type_t<T>>(v));
+        } else if constexpr (std::is_signed_v<T>) {
+            using U = std::make_unsigned_t<T>;
+            return (static_cast<std::uint64_t>(static_cast<U>(v)) << 1) ^ static_cast<std::uint64_t>(v < 0 ? ~U(0) : U(0));
+        } else {
+            return static_cast<std::uint64_t>(v);
+        }
+    }
+
+    template<typename T>
+    T decodeField(std::uint64_t v) {
+        if constexpr (std::is_enum_v<T>) {
+            return static_cast<T>(decodeField<std::underlying_type_t<T>>(v));
+        } else if constexpr (std::is_signed_v<T>) {
+            return static_cast<T>(static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1));
+        } else {
+            return static_cast<T>(v);
+        }
+    }
+
+    // Mistura de 64 bits (finalizador do splitmix)
+    inline std::uint64_t mix(std::uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    inline std::uint64_t hashBytes(const void* data, std::size_t n) {
+        std::uint64_t h = 1469598103934665603ull;
+        const auto* p = static_cast<const std::uint8_t*>(data);
+        for (std::size_t i = 0; i < n; ++i) {
+            h ^= p[i];
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+
+} // namespace journal
+
+// Hash do valor de um componente para checkpoints. Tipos com dados fora do
+// próprio objeto (handles, ponteiros) precisam de especialização.
+template<typename Comp>
+struct StateHash {
+    static_assert(std::has_unique_object_representations_v<Comp>,
+                  "componente com padding ou ponteiros precisa de StateHash próprio");
+    static std::uint64_t of(const Comp& c) { return journal::hashBytes(&c, sizeof(c)); }
+};
+
+// Handles internados variam entre processos; o hash usa o texto
+template<>
+struct StateHash<NameComponent> {
+    static std::uint64_t of(const NameComponent& c) {
+        std::string_view s = c.value.view();
+        return journal::hashBytes(s.data(), s.size());
+    }
+};
+
+// Hash de estado independente da ordem dos pools: soma de hash(entidade, componente).
+// Cada pool é identificado pela posição em Comps..., não por componentTypeID
+// (que depende da ordem em que o processo usou cada tipo pela primeira vez).
+template<typename... Comps>
+std::uint64_t hashState(ECS& ecs) {
+    std::uint64_t h = journal::mix(ecs.getEntities().size());
+    std::uint64_t position = 0;
+    auto hashPool = [&](auto tag) {
+        using Comp = typename decltype(tag)::type;
+        std::uint64_t sum = 0;
+        ecs.view<const Comp>().each([&](EntityID id, const Comp& c) {
+            sum += journal::mix(StateHash<Comp>::of(c) ^ journal::mix(id));
+        });
+        h = journal::mix(h ^ (sum + journal::mix(++position)));
+    };
+    (hashPool(std::common_type<Comps>{}), ...);
+    return h;
+}
+
+template<typename List>
+class EventJournal;
+
+template<typename... Events>
+class EventJournal<EventList<Events...>> {
+public:
+    EventJournal() {
+        buffer = {'E', 'C', 'S', 'J'};
+        journal::putVarint(buffer, JOURNAL_VERSION);
+        journal::putVarint(buffer, sizeof...(Events));
+    }
+
+    // Handler do EventBus: grava cada evento entregue
+    template<typename E>
+    void on(const E& e) {
+        journal::putVarint(buffer, journal::FirstEventTag + indexOf<E>());
+        std::apply([&](auto... member) { (journal::putVarint(buffer, journal::encodeField(e.*member)), ...); },
+                   JournalFields<E>::members);
+        ++events;
+    }
+
+    // Marca o início de um tick (ticks só avançam)
+    void tick(std::uint32_t t) {
+        journal::putVarint(buffer, journal::TickTag);
+        journal::putVarint(buffer, t - lastTick);
+        lastTick = t;
+    }
+
+    // Grava o hash de estado depois do flush do tick
+    void checkpoint(std::uint64_t hash) {
+        journal::putVarint(buffer, journal::CheckpointTag);
+        for (int i = 0; i < 8; ++i) buffer.push_back(static_cast<std::uint8_t>(hash >> (8 * i)));
+    }
+
+    const std::vector<std::uint8_t>& bytes() const { return buffer; }
+    std::uint64_t eventCount() const { return events; }
+
+    bool save(const std::string& path) const {
+        std::FILE* f = std::fopen(path.c_str(), "wb");
+        if (!f) return false;
+        bool ok = std::fwrite(buffer.data(), 1, buffer.size(), f) == buffer.size();
+        return (std::fclose(f) == 0) && ok;
+    }
+
+    template<typename E>
+    static constexpr std::uint32_t indexOf() {
+        static_assert(detail::listed<E, Events...>, "evento fora da EventList do journal");
+        std::uint32_t i = 0;
+        ((std::is_same_v<E, Events> ? false : (++i, true)) && ...);
+        return i;
+    }
+
+private:
+    std::vector<std::uint8_t> buffer;
+    std::uint32_t lastTick = 0;
+    std::uint64_t events = 0;
+};
+
+struct ReplayResult {
+    bool ok = false;              // journal lido inteiro e todos os checkpoints bateram
+    std::string error;
+    std::uint64_t events = 0;
+    std::uint32_t ticks = 0;
+    std::uint32_t checkpoints = 0;
+    std::uint32_t mismatchTick = 0;  // primeiro tick divergente (se houver)
+};
+
+inline std::vector<std::uint8_t> loadJournal(const std::string& path) {
+    std::vector<std::uint8_t> data;
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) return data;
+    std::uint8_t chunk[64 * 1024];
+    std::size_t n;
+    while ((n = std::fread(chunk, 1, sizeof(chunk), f)) > 0) data.insert(data.end(), chunk, chunk + n);
+    std::fclose(f);
+    return data;
+}
+
+namespace journal {
+
+    template<typename E, typename Bus>
+    void postDecoded(Reader& in, Bus& bus) {
+        E e{};
+        std::apply([&](auto... member) {
+            ((e.*member = decodeField<std::remove_reference_t<decltype(e.*member)>>(in.varint())), ...);
+        }, JournalFields<E>::members);
+        if (in.ok) bus.post(e);
+    }
+
+    template<typename... Events, typename Bus, std::size_t... I>
+    bool postByTag(std::uint64_t tag, Reader& in, Bus& bus, std::index_sequence<I...>) {
+        return ((tag == FirstEventTag + I ? (postDecoded<Events>(in, bus), true) : false) || ...);
+    }
+
+} // namespace journal
+
+// Reaplica um journal num mundo já montado com o mesmo estado inicial da gravação.
+// `stateHash()` deve calcular o mesmo hash usado em checkpoint().
+template<typename... Events, typename Bus, typename HashFn>
+ReplayResult replayJournal(EventList<Events...>, const std::vector<std::uint8_t>& data, Bus& bus,
+                           HashFn&& stateHash) {
+    ReplayResult r;
+    journal::Reader in{data.data(), data.data() + data.size()};
+    if (data.size() < 4 || std::memcmp(data.data(), "ECSJ", 4) != 0) {
+        r.error = "cabecalho invalido";
+        return r;
+    }
+    in.p += 4;
+    if (in.varint() != JOURNAL_VERSION || in.varint() != sizeof...(Events)) {
+        r.error = "versao ou lista de eventos diferente";
+        return r;
+    }
+
+    std::uint32_t tick = 0;
+    while (in.ok && in.p < in.end) {
+        std::uint64_t tag = in.varint();
+        if (tag == journal::TickTag) {
+            bus.flush();
+            tick += static_cast<std::uint32_t>(in.varint());
+            ++r.ticks;
+        } else if (tag == journal::CheckpointTag) {
+            std::uint64_t expected = in.fixed64();
+            bus.flush();
+            ++r.checkpoints;
+            if (in.ok && stateHash() != expected) {
+                r.mismatchTick = tick;
+                r.error = "estado divergente no tick " + std::to_string(tick);
+                return r;
+            }
+        } else if (journal::postByTag<Events...>(tag, in, bus, std::index_sequence_for<Events...>{})) {
+            ++r.events;
+        } else {
+            r.error = "tag desconhecida";
+            return r;
+        }
+    }
+    bus.flush();
+    if (!in.ok) {
+        r.error = "journal truncado";
+        return r;
+    }
+    r.ok = true;
+    return r;
+}
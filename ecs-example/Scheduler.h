@@ -0,0 +1,183 @@
+#pragma once
+#include "ECS.h"
+#include "ThreadPool.h"
+#include "CommandBuffer.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Componentes lidos/escritos por um system. Dois systems conflitam quando
+// um escreve um tipo que o outro lê ou escreve.
+class Access {
+public:
+    template<typename... Comps>
+    Access& read() {
+        (add<Comps>(reads), ...);
+        return *this;
+    }
+
+    template<typename... Comps>
+    Access& write() {
+        (add<Comps>(writes), ...);
+        return *this;
+    }
+
+    bool conflicts(const Access& other) const {
+        return overlaps(writes, other.writes)
+            || overlaps(writes, other.reads)
+            || overlaps(reads, other.writes);
+    }
+
+    void preparePools(ECS& ecs) const {
+        for (const auto& e : reads) e.ensure(ecs);
+        for (const auto& e : writes) e.ensure(ecs);
+    }
+
+private:
+    struct Entry {
+        std::uint32_t type;
+        void (*ensure)(ECS&);
+    };
+
+    std::vector<Entry> reads;
+    std::vector<Entry> writes;
+
+    template<typename Comp>
+    static void ensurePool(ECS& ecs) {
+        ecs.registerComponent<Comp>();
+    }
+
+    template<typename Comp>
+    static void add(std::vector<Entry>& list) {
+        list.push_back(Entry{componentTypeID<Comp>(), &ensurePool<Comp>});
+    }
+
+    static bool overlaps(const std::vector<Entry>& a, const std::vector<Entry>& b) {
+        for (const auto& x : a) {
+            for (const auto& y : b) {
+                if (x.type == y.type) return true;
+            }
+        }
+        return false;
+    }
+};
+
+// Passado a cada system durante Scheduler::run
+struct SystemContext {
+    ECS& ecs;
+    ThreadPool& pool;
+    CommandBuffers& commandBuffers;
+    // Tick da execução anterior deste system; use com Added<T>/Changed<T>
+    std::uint32_t since = 0;
+
+    // Buffer da thread atual; mudanças estruturais só valem após o fim do run()
+    CommandBuffer& commands() {
+        return commandBuffers.local(pool);
+    }
+
+    // Divide a view em blocos do pool guia e os distribui entre os workers
+    template<typename... Comps, typename Func>
+    void parallelEach(View<Comps...> view, Func&& fn, std::size_t chunk = 4096) {
+        pool.parallelFor(view.sizeHint(), chunk, [&](std::size_t first, std::size_t last) {
+            view.each(first, last, fn);
+        });
+    }
+};
+
+// Monta um DAG a partir dos acessos declarados (a ordem de registro decide
+// quem roda primeiro em caso de conflito) e executa systems sem conflito
+// ao mesmo tempo no ThreadPool.
+class Scheduler {
+public:
+    using SystemFn = std::function<void(SystemContext&)>;
+
+    explicit Scheduler(ThreadPool& pool) : pool(pool), commandBuffers(pool.size() + 1) {}
+
+    Scheduler& add(std::string name, Access access, SystemFn fn) {
+        systems.push_back(SystemNode{std::move(name), std::move(access), std::move(fn), {}, 0, {}});
+        dirty = true;
+        return *this;
+    }
+
+    void run(ECS& ecs) {
+        if (systems.empty()) return;
+        if (dirty) build();
+
+        for (const auto& s : systems) s.access.preparePools(ecs);
+
+        SystemContext ctx{ecs, pool, commandBuffers};
+        TaskGroup group;
+        for (std::size_t i = 0; i < systems.size(); ++i) {
+            remaining[i].store(systems[i].dependencyCount, std::memory_order_relaxed);
+        }
+        for (std::size_t i = 0; i < systems.size(); ++i) {
+            if (systems[i].dependencyCount == 0) launch(i, ctx, group);
+        }
+        pool.wait(group);
+
+        // Ponto de sincronização: aplica as mudanças estruturais gravadas
+        commandBuffers.apply(ecs);
+    }
+
+    // Ordem topológica por níveis, útil para depuração
+    std::vector<std::vector<std::string>> stages() {
+        if (dirty) build();
+        std::vector<std::size_t> level(systems.size(), 0);
+        std::vector<std::vector<std::string>> out;
+        for (std::size_t i = 0; i < systems.size(); ++i) {
+            for (std::size_t d : systems[i].dependents) {
+                level[d] = std::max(level[d], level[i] + 1);
+            }
+            if (level[i] >= out.size()) out.resize(level[i] + 1);
+            out[level[i]].push_back(systems[i].name);
+        }
+        return out;
+    }
+
+private:
+    struct SystemNode {
+        std::string name;
+        Access access;
+        SystemFn fn;
+        std::vector<std::size_t> dependents;
+        std::size_t dependencyCount;
+        ChangeCursor cursor;
+    };
+
+    ThreadPool& pool;
+    CommandBuffers commandBuffers;
+    std::vector<SystemNode> systems;
+    std::unique_ptr<std::atomic<std::size_t>[]> remaining;
+    bool dirty = true;
+
+    void build() {
+        for (auto& s : systems) {
+            s.dependents.clear();
+            s.dependencyCount = 0;
+        }
+        for (std::size_t j = 0; j < systems.size(); ++j) {
+            for (std::size_t i = 0; i < j; ++i) {
+                if (systems[i].access.conflicts(systems[j].access)) {
+                    systems[i].dependents.push_back(j);
+                    ++systems[j].dependencyCount;
+                }
+            }
+        }
+        remaining = std::make_unique<std::atomic<std::size_t>[]>(systems.size());
+        dirty = false;
+    }
+
+    void launch(std::size_t index, SystemContext& ctx, TaskGroup& group) {
+        pool.run(group, [this, index, &ctx, &group] {
+            SystemContext local = ctx;
+            local.since = systems[index].cursor.begin(ctx.ecs);
+            systems[index].fn(local);
+            for (std::size_t d : systems[index].dependents) {
+                if (remaining[d].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    launch(d, ctx, group);
+                }
+            }
+        });
+    }
+};
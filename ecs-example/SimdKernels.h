@@ -0,0 +1,186 @@
+#pragma once
+#include "Components.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if !defined(ECS_NO_SIMD) && defined(__AVX2__)
+    #include <immintrin.h>
+    #define ECS_SIMD_AVX2 1
+#elif !defined(ECS_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+    #include <emmintrin.h>
+    #define ECS_SIMD_SSE2 1
+#endif
+
+// ============================================================
+//  Kernels em lote para componentes POD de dois ints.
+//
+//  Os pools já guardam Health/Energy como arrays densos de
+//  pares {max, current}; os kernels leem esses arrays direto
+//  (ECS::components<T>()) e tratam cada par como duas lanes
+//  de 32 bits. Caminho escolhido em compilação:
+//    AVX2 (-mavx2) → 4 componentes por instrução
+//    SSE2 (padrão x86-64) → 2 componentes por instrução
+//    escalar (ECS_NO_SIMD ou outras arquiteturas)
+// ============================================================
+
+// Os kernels leem current na lane ímpar de cada par: tamanho e ordem dos campos importam
+static_assert(sizeof(HealthComponent) == 2 * sizeof(int)
+              && offsetof(HealthComponent, maxHP) == 0
+              && offsetof(HealthComponent, currentHP) == sizeof(int),
+              "HealthComponent deve ser {maxHP, currentHP}");
+static_assert(sizeof(EnergyComponent) == 2 * sizeof(int)
+              && offsetof(EnergyComponent, maxEnergy) == 0
+              && offsetof(EnergyComponent, currentEnergy) == sizeof(int),
+              "EnergyComponent deve ser {maxEnergy, currentEnergy}");
+
+namespace kernels {
+
+// Implementações de referência, também usadas para as sobras do laço vetorial
+namespace scalar {
+
+    inline void applyDamage(HealthComponent* hp, const int* damage, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) hp[i].currentHP -= damage[i];
+    }
+
+    inline void applyUniformDamage(HealthComponent* hp, std::size_t n, int amount) {
+        for (std::size_t i = 0; i < n; ++i) hp[i].currentHP -= amount;
+    }
+
+    inline void clampEnergy(EnergyComponent* en, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (en[i].currentEnergy > en[i].maxEnergy) en[i].currentEnergy = en[i].maxEnergy;
+        }
+    }
+
+    // Acrescenta em `out` as posições (no array denso) com currentHP <= 0
+    inline void findDead(const HealthComponent* hp, std::size_t n, std::vector<std::uint32_t>& out,
+                         std::size_t base = 0) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (hp[i].currentHP <= 0) out.push_back(static_cast<std::uint32_t>(base + i));
+        }
+    }
+
+} // namespace scalar
+
+inline const char* backend() {
+#if defined(ECS_SIMD_AVX2)
+    return "avx2";
+#elif defined(ECS_SIMD_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+inline void applyDamage(HealthComponent* hp, const int* damage, std::size_t n) {
+    std::size_t i = 0;
+#if defined(ECS_SIMD_AVX2)
+    auto* p = reinterpret_cast<int*>(hp);
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 2 * i));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(damage + i));
+        // [d0,d1,d2,d3] → [0,d0,0,d1,0,d2,0,d3]: dano só nas lanes de currentHP
+        __m256i spread = _mm256_slli_epi64(_mm256_cvtepu32_epi64(d), 32);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + 2 * i), _mm256_sub_epi32(v, spread));
+    }
+#elif defined(ECS_SIMD_SSE2)
+    auto* p = reinterpret_cast<int*>(hp);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 2 * i));
+        __m128i d = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(damage + i));
+        __m128i spread = _mm_unpacklo_epi32(zero, d);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 2 * i), _mm_sub_epi32(v, spread));
+    }
+#endif
+    scalar::applyDamage(hp + i, damage + i, n - i);
+}
+
+inline void applyUniformDamage(HealthComponent* hp, std::size_t n, int amount) {
+    std::size_t i = 0;
+#if defined(ECS_SIMD_AVX2)
+    auto* p = reinterpret_cast<int*>(hp);
+    const __m256i delta = _mm256_setr_epi32(0, amount, 0, amount, 0, amount, 0, amount);
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 2 * i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + 2 * i), _mm256_sub_epi32(v, delta));
+    }
+#elif defined(ECS_SIMD_SSE2)
+    auto* p = reinterpret_cast<int*>(hp);
+    const __m128i delta = _mm_setr_epi32(0, amount, 0, amount);
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 2 * i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 2 * i), _mm_sub_epi32(v, delta));
+    }
+#endif
+    scalar::applyUniformDamage(hp + i, n - i, amount);
+}
+
+inline void clampEnergy(EnergyComponent* en, std::size_t n) {
+    std::size_t i = 0;
+#if defined(ECS_SIMD_AVX2)
+    auto* p = reinterpret_cast<int*>(en);
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 2 * i));
+        // troca max/current dentro de cada par e fica com o menor nas lanes ímpares
+        __m256i swapped = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+        __m256i clamped = _mm256_blend_epi32(v, _mm256_min_epi32(v, swapped), 0xAA);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + 2 * i), clamped);
+    }
+#elif defined(ECS_SIMD_SSE2)
+    auto* p = reinterpret_cast<int*>(en);
+    const __m128i oddLanes = _mm_setr_epi32(0, -1, 0, -1);
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 2 * i));
+        __m128i swapped = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+        // SSE2 não tem min_epi32: seleciona via máscara onde current > max
+        __m128i over = _mm_and_si128(_mm_cmpgt_epi32(v, swapped), oddLanes);
+        __m128i clamped = _mm_or_si128(_mm_and_si128(over, swapped), _mm_andnot_si128(over, v));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 2 * i), clamped);
+    }
+#endif
+    scalar::clampEnergy(en + i, n - i);
+}
+
+// Mesma assinatura de scalar::findDead (`base` soma-se às posições, para
+// processar o array em pedaços). Compactação sem desvios: escreve toda
+// posição candidata e só avança o cursor nas mortas
+inline void findDead(const HealthComponent* hp, std::size_t n, std::vector<std::uint32_t>& out,
+                     std::size_t base = 0) {
+    std::size_t start = out.size();
+    out.resize(start + n);
+    std::uint32_t* dst = out.data() + start;
+    std::size_t count = 0;
+    std::size_t i = 0;
+#if defined(ECS_SIMD_AVX2)
+    auto* p = reinterpret_cast<const int*>(hp);
+    const __m256i one = _mm256_set1_epi32(1);
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 2 * i));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(one, v))));
+        for (unsigned k = 0; k < 4; ++k) {
+            dst[count] = static_cast<std::uint32_t>(base + i + k);
+            count += (mask >> (2 * k + 1)) & 1u;
+        }
+    }
+#elif defined(ECS_SIMD_SSE2)
+    auto* p = reinterpret_cast<const int*>(hp);
+    const __m128i one = _mm_set1_epi32(1);
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 2 * i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(one, v))));
+        dst[count] = static_cast<std::uint32_t>(base + i);
+        count += (mask >> 1) & 1u;
+        dst[count] = static_cast<std::uint32_t>(base + i + 1);
+        count += (mask >> 3) & 1u;
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[count] = static_cast<std::uint32_t>(base + i);
+        count += hp[i].currentHP <= 0;
+    }
+    out.resize(start + count);
+}
+
+} // namespace kernels
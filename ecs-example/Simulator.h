@@ -0,0 +1,261 @@
+#pragma once
+#include "ECS.h"
+#include "Components.h"
+#include "Events.hpp"
+#include "Prefab.h"
+#include "Systems.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ============================================================
+//  Simulador de combate headless (balanceamento de movesets)
+//
+//  Roda milhões de partidas 1x1 com as mesmas regras do jogo
+//  (CombatSystem + EventBus), sem render nem input, espalhadas
+//  pelo ThreadPool. Cada worker reaproveita um mundo: entre
+//  partidas só os componentes dos dois lutadores são resetados.
+//
+//  Cada partida tem sua própria semente, derivada de (seed,
+//  índice da partida): o resultado não depende de quantas threads
+//  rodaram nem da ordem em que as partidas foram executadas.
+// ============================================================
+
+// splitmix64: barato de semear, uma instância por partida
+struct SimRng {
+    std::uint64_t state;
+
+    std::uint32_t operator()() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return static_cast<std::uint32_t>((z ^ (z >> 31)) >> 32);
+    }
+};
+
+enum class Action : std::uint8_t {
+    Attack = 1,
+    Defend = 2,
+    Special = 3
+};
+
+// Como um lutador escolhe a ação do turno
+struct Policy {
+    enum class Kind { Random, Fixed, Script };
+
+    Kind kind = Kind::Random;
+    Action fixed = Action::Attack;
+    std::vector<Action> script;  // repetido em ciclo
+
+    static Policy random() { return Policy{}; }
+    static Policy always(Action a) { return Policy{Kind::Fixed, a, {}}; }
+    static Policy scripted(std::vector<Action> s) { return Policy{Kind::Script, Action::Attack, std::move(s)}; }
+
+    // "random", "attack", "defend", "special" ou uma sequência como "1,1,3"
+    static Policy parse(const std::string& text) {
+        if (text == "random") return random();
+        if (text == "attack") return always(Action::Attack);
+        if (text == "defend") return always(Action::Defend);
+        if (text == "special") return always(Action::Special);
+        std::vector<Action> s;
+        for (char c : text) {
+            if (c >= '1' && c <= '3') s.push_back(static_cast<Action>(c - '0'));
+        }
+        return s.empty() ? random() : scripted(std::move(s));
+    }
+
+    Action choose(SimRng& rng, int turn) const {
+        switch (kind) {
+            case Kind::Fixed: return fixed;
+            case Kind::Script: return script[static_cast<std::size_t>(turn) % script.size()];
+            default: return static_cast<Action>(1 + rng() % 3);
+        }
+    }
+};
+
+struct SimulationConfig {
+    Prefab player;
+    Prefab enemy;
+    Policy playerPolicy = Policy::random();
+    Policy enemyPolicy = Policy::always(Action::Attack);
+    std::uint64_t matches = 1'000'000;
+    std::uint64_t seed = 1;
+    int maxTurns = 200;  // partidas mais longas contam como empate
+    std::size_t chunk = 4096;
+};
+
+struct SimulationStats {
+    std::uint64_t matches = 0;
+    std::uint64_t playerWins = 0;
+    std::uint64_t enemyWins = 0;
+    std::uint64_t draws = 0;
+    std::uint64_t totalTurns = 0;  // turnos de partidas decididas
+    std::uint64_t winnerHP = 0;    // HP restante do vencedor, somado
+    int minTurns = 0;
+    int maxTurns = 0;
+    std::uint64_t actions[2][4] = {};  // [player/enemy][Action]
+
+    void merge(const SimulationStats& o) {
+        if (o.matches == 0) return;
+        bool firstDecided = playerWins + enemyWins == 0;
+        bool otherDecided = o.playerWins + o.enemyWins > 0;
+        matches += o.matches;
+        playerWins += o.playerWins;
+        enemyWins += o.enemyWins;
+        draws += o.draws;
+        totalTurns += o.totalTurns;
+        winnerHP += o.winnerHP;
+        if (otherDecided) {
+            minTurns = firstDecided ? o.minTurns : std::min(minTurns, o.minTurns);
+            maxTurns = std::max(maxTurns, o.maxTurns);
+        }
+        for (int s = 0; s < 2; ++s) {
+            for (int a = 0; a < 4; ++a) actions[s][a] += o.actions[s][a];
+        }
+    }
+
+    void print(std::FILE* out = stdout) const {
+        auto pct = [&](std::uint64_t v) { return matches ? 100.0 * static_cast<double>(v) / static_cast<double>(matches) : 0.0; };
+        std::uint64_t decided = playerWins + enemyWins;
+        std::fprintf(out, "partidas:          %llu\n", static_cast<unsigned long long>(matches));
+        std::fprintf(out, "vitorias player:   %6.2f%%\n", pct(playerWins));
+        std::fprintf(out, "vitorias inimigo:  %6.2f%%\n", pct(enemyWins));
+        std::fprintf(out, "empates:           %6.2f%%\n", pct(draws));
+        if (decided) {
+            std::fprintf(out, "turnos ate o KO:   media %.2f  min %d  max %d\n",
+                         static_cast<double>(totalTurns) / static_cast<double>(decided), minTurns, maxTurns);
+            std::fprintf(out, "HP do vencedor:    media %.2f\n",
+                         static_cast<double>(winnerHP) / static_cast<double>(decided));
+        }
+        const char* side[2] = {"player", "inimigo"};
+        for (int s = 0; s < 2; ++s) {
+            std::uint64_t total = actions[s][1] + actions[s][2] + actions[s][3];
+            if (!total) continue;
+            auto share = [&](int a) { return 100.0 * static_cast<double>(actions[s][a]) / static_cast<double>(total); };
+            std::fprintf(out, "acoes %-8s     atacar %5.1f%%  defender %5.1f%%  especial %5.1f%%\n",
+                         side[s], share(1), share(2), share(3));
+        }
+    }
+};
+
+class CombatSimulator {
+public:
+    explicit CombatSimulator(SimulationConfig config) : config(std::move(config)) {}
+
+    SimulationStats run(ThreadPool& pool) {
+        std::vector<std::unique_ptr<Worker>> workers(pool.size() + 1);
+        pool.parallelFor(config.matches, config.chunk, [&](std::size_t begin, std::size_t end) {
+            auto& w = workers[pool.currentSlot()];
+            if (!w) w = std::make_unique<Worker>(config);
+            for (std::size_t i = begin; i < end; ++i) w->play(i);
+        });
+        SimulationStats total;
+        for (auto& w : workers) {
+            if (w) total.merge(w->stats);
+        }
+        return total;
+    }
+
+    // Uma partida isolada, reproduzível a partir de (seed, índice)
+    SimulationStats runOne(std::uint64_t match) const {
+        Worker w(config);
+        w.play(match);
+        return w.stats;
+    }
+
+private:
+    SimulationConfig config;
+
+    // Mundo, handlers e estatísticas de uma thread
+    struct Worker {
+        const SimulationConfig& config;
+        ECS ecs;
+        CombatSystem combat;
+        EventBus<CombatEvents, CombatSystem> bus;
+        EntityID player;
+        EntityID enemy;
+        SimulationStats stats;
+
+        explicit Worker(const SimulationConfig& config)
+            : config(config), combat(ecs), bus(combat) {
+            player = config.player.instantiate(ecs);
+            enemy = config.enemy.instantiate(ecs);
+            snapshot(player, playerState);
+            snapshot(enemy, enemyState);
+        }
+
+        void play(std::uint64_t match) {
+            restore(player, playerState);
+            restore(enemy, enemyState);
+            SimRng rng{config.seed ^ (match * 0xD1B54A32D192ED03ull)};
+
+            const HealthComponent* ph = ecs.getComponent<const HealthComponent>(player);
+            const HealthComponent* eh = ecs.getComponent<const HealthComponent>(enemy);
+            int turn = 0;
+            bool playerTurn = true;
+            while (turn < config.maxTurns && ph->currentHP > 0 && eh->currentHP > 0) {
+                if (playerTurn) act(0, config.playerPolicy.choose(rng, turn / 2), player, enemy);
+                else act(1, config.enemyPolicy.choose(rng, turn / 2), enemy, player);
+                bus.flush();
+                playerTurn = !playerTurn;
+                ++turn;
+            }
+
+            ++stats.matches;
+            bool playerDead = ph->currentHP <= 0;
+            bool enemyDead = eh->currentHP <= 0;
+            if (!playerDead && !enemyDead) {
+                ++stats.draws;
+                return;
+            }
+            if (enemyDead) {
+                ++stats.playerWins;
+                stats.winnerHP += static_cast<std::uint64_t>(std::max(ph->currentHP, 0));
+            } else {
+                ++stats.enemyWins;
+                stats.winnerHP += static_cast<std::uint64_t>(std::max(eh->currentHP, 0));
+            }
+            bool first = stats.playerWins + stats.enemyWins == 1;
+            stats.totalTurns += static_cast<std::uint64_t>(turn);
+            stats.minTurns = first ? turn : std::min(stats.minTurns, turn);
+            stats.maxTurns = std::max(stats.maxTurns, turn);
+        }
+
+    private:
+        struct State {
+            HealthComponent hp{};
+            EnergyComponent en{};
+            bool hasEnergy = false;
+        };
+        State playerState;
+        State enemyState;
+
+        void act(int side, Action a, EntityID self, EntityID other) {
+            ++stats.actions[side][static_cast<int>(a)];
+            switch (a) {
+                case Action::Attack: bus.post(AttackEvent{self, other}); break;
+                case Action::Defend: bus.post(DefendEvent{self}); break;
+                case Action::Special: bus.post(SpecialEvent{self, other}); break;
+            }
+        }
+
+        void snapshot(EntityID e, State& s) {
+            auto* hp = ecs.getComponent<const HealthComponent>(e);
+            assert(hp && "prefab de lutador precisa de HealthComponent");
+            s.hp = *hp;
+            if (auto* en = ecs.getComponent<const EnergyComponent>(e)) {
+                s.en = *en;
+                s.hasEnergy = true;
+            }
+        }
+
+        void restore(EntityID e, const State& s) {
+            *ecs.getComponent<HealthComponent>(e) = s.hp;
+            if (s.hasEnergy) *ecs.getComponent<EnergyComponent>(e) = s.en;
+        }
+    };
+};
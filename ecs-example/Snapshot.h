@@ -0,0 +1,427 @@
+#pragma once
+#include "ECS.h"
+#include "Components.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// ============================================================
+//  Snapshot binário de um mundo ECS ("Save State")
+//
+//  Layout (little-endian nativo, blocos alinhados em 8 bytes):
+//    SnapshotHeader
+//    entities[entityCount] generations[indexCount]
+//    entityPos[indexCount] freeList[freeCount]
+//    por pool: PoolHeader, owners[count], dados, sparse[sparseSize]
+//    seção de strings empacotadas (stringBytes)
+//
+//  Pools trivialmente copiáveis são gravados como o array denso
+//  cru; na carga o arquivo é mapeado (mmap / MapViewOfFile) e cada
+//  bloco vira uma única cópia para o pool — sem parse por entidade.
+//  Componentes com dados variáveis (NameComponent) gravam pares
+//  {offset, tamanho} apontando para a seção de strings.
+// ============================================================
+
+constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+
+struct SnapshotHeader {
+    char          magic[4];
+    std::uint32_t version;
+    std::uint32_t poolCount;
+    std::uint32_t entityCount;
+    std::uint32_t indexCount;
+    std::uint32_t freeCount;
+    std::uint64_t stringBytes;
+};
+
+struct SnapshotPoolHeader {
+    std::uint64_t typeHash;
+    std::uint32_t encoding;
+    std::uint32_t elemSize;
+    std::uint32_t count;
+    std::uint32_t sparseSize;
+};
+
+struct SnapshotStringRef {
+    std::uint32_t offset;
+    std::uint32_t length;
+};
+
+enum class SnapshotEncoding : std::uint32_t {
+    Raw     = 0,
+    Strings = 1
+};
+
+// Tipos trivialmente copiáveis usam Raw; os demais precisam de uma especialização
+template<typename Comp>
+struct SnapshotCodec {
+    static_assert(std::is_trivially_copyable_v<Comp>,
+                  "componente não trivialmente copiável precisa de SnapshotCodec próprio");
+    static constexpr SnapshotEncoding encoding = SnapshotEncoding::Raw;
+};
+
+template<>
+struct SnapshotCodec<NameComponent> {
+    static constexpr SnapshotEncoding encoding = SnapshotEncoding::Strings;
+    static std::string_view text(const NameComponent& c) { return c.value.view(); }
+    static NameComponent fromText(std::string_view s) { return NameComponent{InternedString(s)}; }
+};
+
+// Arquivo mapeado somente leitura
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return;
+        LARGE_INTEGER sz;
+        if (!GetFileSizeEx(file, &sz) || sz.QuadPart == 0) return;
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) return;
+        ptr = static_cast<const std::uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (ptr) length = static_cast<std::size_t>(sz.QuadPart);
+#else
+        fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size == 0) return;
+        void* p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) return;
+        ptr = static_cast<const std::uint8_t*>(p);
+        length = static_cast<std::size_t>(st.st_size);
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef _WIN32
+        if (ptr) UnmapViewOfFile(ptr);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+#else
+        if (ptr) ::munmap(const_cast<std::uint8_t*>(ptr), length);
+        if (fd >= 0) ::close(fd);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool valid() const { return ptr != nullptr; }
+    const std::uint8_t* data() const { return ptr; }
+    std::size_t size() const { return length; }
+
+private:
+    const std::uint8_t* ptr = nullptr;
+    std::size_t length = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+};
+
+// Lista os componentes que entram no snapshot. O nome registrado identifica o
+// pool no arquivo (hash FNV-1a), então deve ser estável entre versões.
+//   WorldSnapshot snap;
+//   snap.add<HealthComponent>("Health").add<NameComponent>("Name");
+//   snap.save(ecs, "world.ecss");  snap.load(other, "world.ecss");
+class WorldSnapshot {
+public:
+    template<typename Comp>
+    WorldSnapshot& add(std::string_view name) {
+        entries.push_back(Entry{hashName(name), componentTypeID<Comp>(), &savePool<Comp>, &loadPool<Comp>});
+        return *this;
+    }
+
+    bool save(ECS& ecs, const std::string& path) const {
+        std::FILE* f = std::fopen(path.c_str(), "wb");
+        if (!f) return false;
+        Writer out{f};
+
+        SnapshotHeader header{{'E', 'C', 'S', 'S'}, SNAPSHOT_VERSION, 0,
+                              static_cast<std::uint32_t>(ecs.entities.size()),
+                              static_cast<std::uint32_t>(ecs.generations.size()),
+                              static_cast<std::uint32_t>(ecs.freeList.size()), 0};
+        out.write(&header, sizeof(header));
+        out.writeArray(ecs.entities);
+        out.writeArray(ecs.generations);
+        out.writeArray(ecs.entityPos);
+        out.writeArray(ecs.freeList);
+
+        std::string strings;
+        for (const auto& e : entries) {
+            if (e.type < ecs.pools.size() && ecs.pools[e.type]) {
+                e.save(ecs, e.hash, out, strings);
+                ++header.poolCount;
+            }
+        }
+        out.write(strings.data(), strings.size());
+        header.stringBytes = strings.size();
+
+        bool ok = out.ok && std::fseek(f, 0, SEEK_SET) == 0
+               && std::fwrite(&header, sizeof(header), 1, f) == 1;
+        ok = (std::fclose(f) == 0) && ok;
+        return ok;
+    }
+
+    // Substitui todo o conteúdo de `ecs`. Pools do arquivo sem registro são ignorados.
+    bool load(ECS& ecs, const std::string& path) const {
+        MappedFile file(path);
+        if (!file.valid()) return false;
+        Reader in{file.data(), file.data() + file.size()};
+
+        SnapshotHeader header;
+        if (!in.read(&header, sizeof(header))) return false;
+        if (std::memcmp(header.magic, "ECSS", 4) != 0 || header.version != SNAPSHOT_VERSION) return false;
+        if (header.stringBytes > file.size()) return false;
+        const char* strings = reinterpret_cast<const char*>(file.data() + file.size() - header.stringBytes);
+
+        const EntityID* entities = in.take<EntityID>(header.entityCount);
+        const std::uint32_t* generations = in.take<std::uint32_t>(header.indexCount);
+        const std::uint32_t* entityPos = in.take<std::uint32_t>(header.indexCount);
+        const std::uint32_t* freeList = in.take<std::uint32_t>(header.freeCount);
+        if (!in.ok) return false;
+        if (!validEntities(header, entities, generations, entityPos, freeList)) return false;
+
+        // Mantém o backend de memória do mundo de destino: um mundo com
+        // arena própria ganha uma arena nova; um com memory_resource
+        // externo continua nele
+        ECS loaded = ecs.arena ? ECS() : ECS(ecs.resource);
+        loaded.clock = std::move(ecs.clock);
+        loaded.entities.assign(entities, entities + header.entityCount);
+        loaded.generations.assign(generations, generations + header.indexCount);
+        loaded.entityPos.assign(entityPos, entityPos + header.indexCount);
+        loaded.freeList.assign(freeList, freeList + header.freeCount);
+
+        for (std::uint32_t p = 0; p < header.poolCount; ++p) {
+            SnapshotPoolHeader ph;
+            if (!in.read(&ph, sizeof(ph))) return false;
+            PoolBlock block{ph, nullptr, nullptr, nullptr, strings, header.stringBytes,
+                            header.indexCount, generations, entityPos};
+            block.owners = in.take<EntityID>(ph.count);
+            block.data = in.take<std::uint8_t>(std::size_t(ph.count) * ph.elemSize);
+            block.sparse = in.take<std::uint32_t>(ph.sparseSize);
+            if (!in.ok || !validPool(block)) return false;
+
+            for (const auto& e : entries) {
+                if (e.hash == ph.typeHash) {
+                    if (!e.load(loaded, block)) return false;
+                    break;
+                }
+            }
+        }
+
+        // Índices continuam registrados e se reconstroem sobre os pools novos
+        loaded.indexes = std::move(ecs.indexes);
+        for (auto& entry : loaded.indexes) entry.second->invalidate();
+
+        ecs = std::move(loaded);
+        return true;
+    }
+
+private:
+    struct Writer {
+        std::FILE* f;
+        std::uint64_t offset = 0;
+        bool ok = true;
+
+        void write(const void* p, std::size_t n) {
+            if (n == 0) return;
+            ok = ok && std::fwrite(p, 1, n, f) == n;
+            offset += n;
+        }
+
+        void pad() {
+            static const char zeros[8] = {};
+            write(zeros, (8 - offset % 8) % 8);
+        }
+
+        template<typename T>
+        void writeArray(const T* p, std::size_t count) {
+            write(p, count * sizeof(T));
+            pad();
+        }
+
+        template<typename T, typename Alloc>
+        void writeArray(const std::vector<T, Alloc>& v) {
+            writeArray(v.data(), v.size());
+        }
+    };
+
+    struct Reader {
+        const std::uint8_t* cur;
+        const std::uint8_t* end;
+        const std::uint8_t* begin = cur;
+        bool ok = true;
+
+        bool read(void* dst, std::size_t n) {
+            if (!ok || static_cast<std::size_t>(end - cur) < n) return ok = false;
+            std::memcpy(dst, cur, n);
+            cur += n;
+            return true;
+        }
+
+        // Ponteiro direto para o mapeamento; blocos são alinhados em 8 no arquivo
+        template<typename T>
+        const T* take(std::size_t count) {
+            std::size_t n = count * sizeof(T);
+            if (!ok || static_cast<std::size_t>(end - cur) < n) {
+                ok = false;
+                return nullptr;
+            }
+            const T* p = reinterpret_cast<const T*>(cur);
+            cur += n;
+            std::size_t off = static_cast<std::size_t>(cur - begin);
+            cur += (8 - off % 8) % 8;
+            if (cur > end) cur = end;
+            return p;
+        }
+    };
+
+    struct PoolBlock {
+        SnapshotPoolHeader header;
+        const EntityID* owners;
+        const std::uint8_t* data;
+        const std::uint32_t* sparse;
+        const char* strings;
+        std::uint64_t stringBytes;
+        std::uint32_t indexCount;  // tamanho de generations no mundo
+        const std::uint32_t* generations;
+        const std::uint32_t* entityPos;
+    };
+
+    struct Entry {
+        std::uint64_t hash;
+        std::uint32_t type;
+        void (*save)(ECS&, std::uint64_t, Writer&, std::string&);
+        bool (*load)(ECS&, const PoolBlock&);
+    };
+
+    std::vector<Entry> entries;
+
+    // O arquivo não é confiável: antes de copiar qualquer array, confere que
+    // os índices entre eles batem, senão find()/isAlive leriam fora dos limites.
+    // A geração de cada entidade viva tem de ser a atual do seu índice: um ID
+    // com geração velha seria um fantasma que destroyEntity não remove.
+    static bool validEntities(const SnapshotHeader& h, const EntityID* entities,
+                              const std::uint32_t* generations, const std::uint32_t* entityPos,
+                              const std::uint32_t* freeList) {
+        for (std::uint32_t i = 0; i < h.entityCount; ++i) {
+            std::uint32_t idx = entityIndex(entities[i]);
+            if (idx >= h.indexCount || entityPos[idx] != i) return false;
+            if (generations[idx] != entityGeneration(entities[i])) return false;
+        }
+        for (std::uint32_t i = 0; i < h.indexCount; ++i) {
+            if (entityPos[i] != ECS::DEAD && entityPos[i] >= h.entityCount) return false;
+            if (generations[i] > ENTITY_GENERATION_MASK) return false;
+        }
+        for (std::uint32_t i = 0; i < h.freeCount; ++i) {
+            if (freeList[i] >= h.indexCount || entityPos[freeList[i]] != ECS::DEAD) return false;
+        }
+        return true;
+    }
+
+    // owners e sparse precisam ser inversos um do outro dentro dos limites, e
+    // cada dono precisa estar vivo com a geração atual do seu índice
+    static bool validPool(const PoolBlock& block) {
+        const SnapshotPoolHeader& ph = block.header;
+        constexpr std::uint32_t npos = UINT32_MAX;
+        for (std::uint32_t i = 0; i < ph.count; ++i) {
+            std::uint32_t idx = entityIndex(block.owners[i]);
+            if (idx >= block.indexCount || idx >= ph.sparseSize || block.sparse[idx] != i) return false;
+            if (block.entityPos[idx] == ECS::DEAD
+                || block.generations[idx] != entityGeneration(block.owners[i])) return false;
+        }
+        for (std::uint32_t i = 0; i < ph.sparseSize; ++i) {
+            std::uint32_t pos = block.sparse[i];
+            if (pos != npos && (pos >= ph.count || entityIndex(block.owners[pos]) != i)) return false;
+        }
+        return true;
+    }
+
+    static std::uint64_t hashName(std::string_view name) {
+        std::uint64_t h = 1469598103934665603ull;
+        for (char c : name) {
+            h ^= static_cast<std::uint8_t>(c);
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+
+    template<typename Comp>
+    static void savePool(ECS& ecs, std::uint64_t hash, Writer& out, std::string& strings) {
+        using Codec = SnapshotCodec<Comp>;
+        auto& pool = ecs.getPool<const Comp>();
+        const auto& owners = pool.entities();
+        const auto& sparse = pool.sparseTable();
+
+        SnapshotPoolHeader ph{hash, static_cast<std::uint32_t>(Codec::encoding), 0,
+                              static_cast<std::uint32_t>(owners.size()),
+                              static_cast<std::uint32_t>(sparse.size())};
+        if constexpr (Codec::encoding == SnapshotEncoding::Raw) {
+            ph.elemSize = sizeof(Comp);
+            out.write(&ph, sizeof(ph));
+            out.writeArray(owners);
+            out.writeArray(pool.data(), pool.size());
+        } else {
+            ph.elemSize = sizeof(SnapshotStringRef);
+            std::vector<SnapshotStringRef> refs;
+            refs.reserve(pool.size());
+            for (std::size_t i = 0; i < pool.size(); ++i) {
+                std::string_view text = Codec::text(pool.data()[i]);
+                refs.push_back({static_cast<std::uint32_t>(strings.size()),
+                                static_cast<std::uint32_t>(text.size())});
+                strings.append(text);
+            }
+            out.write(&ph, sizeof(ph));
+            out.writeArray(owners);
+            out.writeArray(refs);
+        }
+        out.writeArray(sparse);
+    }
+
+    template<typename Comp>
+    static bool loadPool(ECS& ecs, const PoolBlock& block) {
+        using Codec = SnapshotCodec<Comp>;
+        const auto& ph = block.header;
+        if (ph.encoding != static_cast<std::uint32_t>(Codec::encoding)) return false;
+
+        auto& pool = ecs.getPool<Comp>();
+        std::uint32_t tick = ecs.currentTick();
+        if constexpr (Codec::encoding == SnapshotEncoding::Raw) {
+            if (ph.elemSize != sizeof(Comp)) return false;
+            pool.assignRaw(block.owners, reinterpret_cast<const Comp*>(block.data), ph.count,
+                           block.sparse, ph.sparseSize, tick);
+        } else {
+            if (ph.elemSize != sizeof(SnapshotStringRef)) return false;
+            const auto* refs = reinterpret_cast<const SnapshotStringRef*>(block.data);
+            for (std::uint32_t i = 0; i < ph.count; ++i) {
+                if (std::uint64_t(refs[i].offset) + refs[i].length > block.stringBytes) return false;
+            }
+            pool.assign(block.owners, ph.count, block.sparse, ph.sparseSize, tick, [&](std::size_t i) {
+                return Codec::fromText(std::string_view(block.strings + refs[i].offset, refs[i].length));
+            });
+        }
+        return true;
+    }
+};
@@ -0,0 +1,151 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================
+//  Tabela global de strings internadas
+//
+//  Cada texto distinto é guardado uma única vez numa arena de
+//  blocos; InternedString é só um índice de 32 bits para essa
+//  tabela. Mil minions chamados "Goblin" custam 4 bytes cada e
+//  comparar nomes vira comparar inteiros.
+//
+//  Internar trava um mutex (só na criação); ler o texto não trava:
+//  as páginas de entradas nunca mudam de lugar depois de publicadas.
+//  Strings nunca são liberadas — o conjunto de nomes de um jogo é
+//  pequeno e estável.
+// ============================================================
+
+class StringPool {
+public:
+    static StringPool& global() {
+        static StringPool pool;
+        return pool;
+    }
+
+    // Devolve o id de `s`, criando a entrada se for nova. "" é sempre o id 0.
+    std::uint32_t intern(std::string_view s) {
+        if (s.empty()) return 0;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = lookup.find(s);
+        if (it != lookup.end()) return it->second;
+
+        std::uint32_t id = count.load(std::memory_order_relaxed);
+        std::size_t page = id / PAGE_SIZE;
+        if (page >= MAX_PAGES) throw std::length_error("StringPool cheio");
+        if (!pages[page].load(std::memory_order_relaxed)) {
+            pages[page].store(new Entry[PAGE_SIZE](), std::memory_order_release);
+        }
+        Entry& e = pages[page].load(std::memory_order_relaxed)[id % PAGE_SIZE];
+        e.data = store(s);
+        e.length = static_cast<std::uint32_t>(s.size());
+
+        lookup.emplace(std::string_view(e.data, e.length), id);
+        count.store(id + 1, std::memory_order_release);
+        return id;
+    }
+
+    std::string_view view(std::uint32_t id) const {
+        if (id == 0) return {};
+        const Entry& e = pages[id / PAGE_SIZE].load(std::memory_order_acquire)[id % PAGE_SIZE];
+        return {e.data, e.length};
+    }
+
+    // Quantidade de strings distintas (inclui o "" do id 0)
+    std::size_t size() const { return count.load(std::memory_order_acquire); }
+
+    // Bytes reservados pela arena de texto
+    std::size_t bytes() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return arenaBytes;
+    }
+
+    ~StringPool() {
+        for (auto& p : pages) delete[] p.load(std::memory_order_relaxed);
+    }
+
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+private:
+    struct Entry {
+        const char* data;
+        std::uint32_t length;
+    };
+
+    static constexpr std::size_t PAGE_SIZE = 4096;
+    static constexpr std::size_t MAX_PAGES = 1024;
+    static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+
+    StringPool() {
+        pages[0].store(new Entry[PAGE_SIZE](), std::memory_order_relaxed);
+        pages[0].load(std::memory_order_relaxed)[0] = Entry{"", 0};
+    }
+
+    // Copia o texto para a arena; strings grandes ganham alocação própria
+    const char* store(std::string_view s) {
+        if (s.size() > BLOCK_SIZE / 4) {
+            large.emplace_back(new char[s.size()]);
+            arenaBytes += s.size();
+            std::memcpy(large.back().get(), s.data(), s.size());
+            return large.back().get();
+        }
+        if (blocks.empty() || blockUsed + s.size() > BLOCK_SIZE) {
+            blocks.emplace_back(new char[BLOCK_SIZE]);
+            blockUsed = 0;
+            arenaBytes += BLOCK_SIZE;
+        }
+        char* dst = blocks.back().get() + blockUsed;
+        std::memcpy(dst, s.data(), s.size());
+        blockUsed += s.size();
+        return dst;
+    }
+
+    mutable std::mutex mutex;
+    std::array<std::atomic<Entry*>, MAX_PAGES> pages{};
+    std::atomic<std::uint32_t> count{1};
+    std::unordered_map<std::string_view, std::uint32_t> lookup;
+    std::vector<std::unique_ptr<char[]>> blocks;
+    std::vector<std::unique_ptr<char[]>> large;
+    std::size_t blockUsed = 0;
+    std::size_t arenaBytes = 0;
+};
+
+// Handle para uma string internada; cópia e comparação custam um inteiro
+class InternedString {
+public:
+    InternedString() = default;
+    InternedString(std::string_view s) : id(StringPool::global().intern(s)) {}
+    InternedString(const char* s) : InternedString(std::string_view(s)) {}
+    InternedString(const std::string& s) : InternedString(std::string_view(s)) {}
+
+    std::string_view view() const { return StringPool::global().view(id); }
+    std::string str() const { return std::string(view()); }
+    std::uint32_t handle() const { return id; }
+    bool empty() const { return id == 0; }
+
+    friend bool operator==(InternedString a, InternedString b) { return a.id == b.id; }
+    friend bool operator!=(InternedString a, InternedString b) { return a.id != b.id; }
+
+    friend std::ostream& operator<<(std::ostream& os, InternedString s) { return os << s.view(); }
+
+private:
+    std::uint32_t id = 0;
+};
+
+namespace std {
+    template<>
+    struct hash<InternedString> {
+        size_t operator()(InternedString s) const noexcept { return s.handle(); }
+    };
+}
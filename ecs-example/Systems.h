@@ -3,10 +3,17 @@
 #include "Components.h"
 #include "Events.hpp"
 #include <iostream>
+#include <vector>
 
 class RenderSystem {
 public:
+    // Só redesenha quando nome, vida ou energia mudaram desde o último draw
     void draw(ECS& ecs) {
+        std::uint32_t since = cursor.begin(ecs);
+        if (since != 0 && !changedSince<NameComponent, HealthComponent, EnergyComponent>(ecs, since)) {
+            return;
+        }
+
         // limpa o terminal
         #ifdef _WIN32
             system("cls");
@@ -14,51 +21,77 @@ public:
             system("clear");
         #endif
 
-        for (auto id : ecs.getEntities()) {
-            auto name = ecs.getComponent<NameComponent>(id);
-            auto hp   = ecs.getComponent<HealthComponent>(id);
-            auto en   = ecs.getComponent<EnergyComponent>(id);
+        ecs.view<const NameComponent, const HealthComponent, const EnergyComponent>().each(
+            [](EntityID, const NameComponent& name, const HealthComponent& hp, const EnergyComponent& en) {
+                std::cout << "=== " << name.value << " ===\n";
+                std::cout << "HP: " << hp.currentHP << " / " << hp.maxHP << "\n";
+                std::cout << "EN: " << en.currentEnergy << " / " << en.maxEnergy << "\n\n";
+            });
+    }
 
-            if (name && hp && en) {
-                std::cout << "=== " << name->value << " ===\n";
-                std::cout << "HP: " << hp->currentHP << " / " << hp->maxHP << "\n";
-                std::cout << "EN: " << en->currentEnergy << " / " << en->maxEnergy << "\n\n";
-            }
-        }
+private:
+    ChangeCursor cursor;
+
+    template<typename... Comps>
+    static bool changedSince(ECS& ecs, std::uint32_t since) {
+        bool any = false;
+        ((ecs.view<Changed<Comps>>(since).each([&](EntityID, const Comps&) { any = true; }), any) || ...);
+        return any;
     }
 };
 
+// Handler dos eventos de combate (ver Events.hpp).
+// Ataques e especiais chegam em lote: o dano é somado por alvo e aplicado
+// com uma única busca do componente de vida.
 class CombatSystem {
 public:
-    CombatSystem(EventBus& bus) : eventBus(bus) {}
-
-    void registerHandlers(ECS& ecs) {
-        eventBus.subscribe(EvtType::Attack, [&](const Event& e) {
-            auto atk = ecs.getComponent<StatsComponent>(e.sourceID);
-            auto targetHp = ecs.getComponent<HealthComponent>(e.targetID);
+    explicit CombatSystem(ECS& ecs) : ecs(ecs) {}
 
-            if (atk && targetHp) {
-                targetHp->currentHP -= atk->attack;
-            }
+    void onBatch(EventSpan<AttackEvent> events) {
+        applyDamage(events, [&](const AttackEvent& e) {
+            auto atk = ecs.getComponent<const StatsComponent>(e.source);
+            return atk ? atk->attack : 0;
         });
+    }
 
-        eventBus.subscribe(EvtType::Defend, [&](const Event& e) {
-            auto en = ecs.getComponent<EnergyComponent>(e.sourceID);
-            if (en) {
-                en->currentEnergy += 5;
-            }
-        });
+    void on(const DefendEvent& e) {
+        auto en = ecs.getComponent<EnergyComponent>(e.source);
+        if (en) {
+            en->currentEnergy += 5;
+        }
+    }
 
-        eventBus.subscribe(EvtType::Special, [&](const Event& e) {
-            auto targetHp = ecs.getComponent<HealthComponent>(e.targetID);
-            if (targetHp) {
-                targetHp->currentHP -= 20;
-            }
-        });
+    void onBatch(EventSpan<SpecialEvent> events) {
+        applyDamage(events, [](const SpecialEvent&) { return 20; });
     }
 
 private:
-    EventBus& eventBus;
+    ECS& ecs;
+
+    // Soma do lote por alvo, indexada pelo índice da entidade (sem ordenação)
+    std::vector<int> slotOf;
+    std::vector<std::pair<EntityID, int>> hits;
+
+    template<typename E, typename DamageOf>
+    void applyDamage(EventSpan<E> events, DamageOf&& damageOf) {
+        for (const E& e : events) {
+            std::uint32_t idx = entityIndex(e.target);
+            if (idx >= slotOf.size()) slotOf.resize(idx + 1, -1);
+            int& slot = slotOf[idx];
+            if (slot < 0 || hits[slot].first != e.target) {
+                slot = static_cast<int>(hits.size());
+                hits.emplace_back(e.target, 0);
+            }
+            hits[slot].second += damageOf(e);
+        }
+        for (const auto& [target, total] : hits) {
+            slotOf[entityIndex(target)] = -1;
+            if (auto targetHp = ecs.getComponent<HealthComponent>(target)) {
+                targetHp->currentHP -= total;
+            }
+        }
+        hits.clear();
+    }
 };
 
 class InputSystem {
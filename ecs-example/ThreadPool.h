@@ -0,0 +1,170 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Contador de tarefas de um lote. ThreadPool::wait() executa tarefas
+// enquanto espera, então é seguro esperar de dentro de outra tarefa.
+class TaskGroup {
+public:
+    bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class ThreadPool;
+    std::atomic<std::size_t> pending{0};
+};
+
+// Pool com uma fila por worker: o dono consome do fim (LIFO, cache quente),
+// workers ociosos roubam do início das filas dos outros.
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+    explicit ThreadPool(unsigned threads = std::thread::hardware_concurrency()) {
+        if (threads == 0) threads = 1;
+        for (unsigned i = 0; i < threads; ++i) {
+            queues.push_back(std::make_unique<WorkQueue>());
+        }
+        for (unsigned i = 0; i < threads; ++i) {
+            workers.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(sleepMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& t : workers) t.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t size() const { return workers.size(); }
+
+    // Slot da thread atual: [0, size()) nos workers, size() em threads externas
+    std::size_t currentSlot() const {
+        return tlsPool == this ? tlsIndex : size();
+    }
+
+    void run(TaskGroup& group, Task task) {
+        group.pending.fetch_add(1, std::memory_order_relaxed);
+        Task wrapped = [&group, task = std::move(task)] {
+            task();
+            group.pending.fetch_sub(1, std::memory_order_acq_rel);
+        };
+
+        std::size_t slot = currentSlot();
+        if (slot == size()) {
+            slot = nextQueue.fetch_add(1, std::memory_order_relaxed) % size();
+        }
+        {
+            std::lock_guard lock(queues[slot]->mutex);
+            queues[slot]->tasks.push_back(std::move(wrapped));
+        }
+        queued.fetch_add(1, std::memory_order_release);
+        {
+            std::lock_guard lock(sleepMutex);
+        }
+        wake.notify_one();
+    }
+
+    void wait(TaskGroup& group) {
+        std::size_t home = currentSlot();
+        while (!group.done()) {
+            if (!runOne(home)) std::this_thread::yield();
+        }
+    }
+
+    // Divide [0, count) em blocos de `chunk` e chama fn(begin, end) em paralelo
+    template<typename Func>
+    void parallelFor(std::size_t count, std::size_t chunk, Func&& fn) {
+        if (count == 0) return;
+        chunk = std::max<std::size_t>(chunk, 1);
+        if (count <= chunk) {
+            fn(std::size_t{0}, count);
+            return;
+        }
+        TaskGroup group;
+        for (std::size_t begin = 0; begin < count; begin += chunk) {
+            std::size_t end = std::min(count, begin + chunk);
+            run(group, [&fn, begin, end] { fn(begin, end); });
+        }
+        wait(group);
+    }
+
+private:
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    static inline thread_local const ThreadPool* tlsPool = nullptr;
+    static inline thread_local std::size_t tlsIndex = 0;
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<std::size_t> nextQueue{0};
+    std::atomic<std::size_t> queued{0};
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping = false;
+
+    bool runOne(std::size_t home) {
+        Task task;
+        if (popLocal(home, task) || steal(home, task)) {
+            task();
+            return true;
+        }
+        return false;
+    }
+
+    bool popLocal(std::size_t home, Task& out) {
+        if (home >= queues.size()) return false;
+        WorkQueue& q = *queues[home];
+        std::lock_guard lock(q.mutex);
+        if (q.tasks.empty()) return false;
+        out = std::move(q.tasks.back());
+        q.tasks.pop_back();
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool steal(std::size_t home, Task& out) {
+        std::size_t n = queues.size();
+        for (std::size_t k = 1; k <= n; ++k) {
+            std::size_t victim = (home + k) % n;
+            if (victim == home) continue;
+            WorkQueue& q = *queues[victim];
+            std::lock_guard lock(q.mutex);
+            if (q.tasks.empty()) continue;
+            out = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    void workerLoop(std::size_t index) {
+        tlsPool = this;
+        tlsIndex = index;
+        while (true) {
+            if (runOne(index)) continue;
+            std::unique_lock lock(sleepMutex);
+            if (stopping) return;
+            wake.wait_for(lock, std::chrono::milliseconds(1), [this] {
+                return stopping || queued.load(std::memory_order_acquire) > 0;
+            });
+        }
+    }
+};
@@ -1,40 +1,137 @@
 #include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include <chrono>
+#include <cstdio>
 #include "ECS.h"
 #include "Components.h"
 #include "Systems.h"
 #include "Events.hpp"
+#include "Journal.h"
+#include "Prefab.h"
+#include "Simulator.h"
 
 using namespace std;
 
-int main() {
+// Lutadores do jogo, usados tanto no modo interativo quanto no headless
+Prefab playerPrefab() {
+    Prefab p;
+    p.with(NameComponent{"Player"})
+     .with(HealthComponent{100, 100})
+     .with(EnergyComponent{50, 50})
+     .with(StatsComponent{15, 5});
+    return p;
+}
+
+Prefab enemyPrefab() {
+    Prefab p;
+    p.with(NameComponent{"CPU"})
+     .with(HealthComponent{80, 80})
+     .with(EnergyComponent{30, 30})
+     .with(StatsComponent{10, 4});
+    return p;
+}
+
+// Hash dos componentes que o combate altera, usado nos checkpoints do journal
+uint64_t combatStateHash(ECS& ecs) {
+    return hashState<HealthComponent, EnergyComponent, StatsComponent>(ecs);
+}
+
+// Replay: main --replay arquivo.ecsj
+// Monta o mundo inicial a partir dos prefabs e reaplica o journal sem render
+int runReplay(const char* path) {
+    vector<uint8_t> data = loadJournal(path);
+    if (data.empty()) {
+        cerr << "nao foi possivel ler " << path << "\n";
+        return 2;
+    }
+
     ECS ecs;
-    EventBus eventBus;
-
-    // Criar player
-    int player = ecs.createEntity();
-    ecs.addComponent(player, NameComponent{"Player"});
-    ecs.addComponent(player, HealthComponent{100, 100});
-    ecs.addComponent(player, EnergyComponent{50, 50});
-    ecs.addComponent(player, StatsComponent{15, 5});
-
-    // Criar inimigo
-    int enemy  = ecs.createEntity();
-    ecs.addComponent(enemy, NameComponent{"CPU"});
-    ecs.addComponent(enemy, HealthComponent{80, 80});
-    ecs.addComponent(enemy, EnergyComponent{30, 30});
-    ecs.addComponent(enemy, StatsComponent{10, 4});
+    playerPrefab().instantiate(ecs);
+    enemyPrefab().instantiate(ecs);
+    CombatSystem combat(ecs);
+    EventBus<CombatEvents, CombatSystem> bus(combat);
+
+    auto t0 = chrono::steady_clock::now();
+    ReplayResult r = replayJournal(CombatEvents{}, data, bus, [&] { return combatStateHash(ecs); });
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+
+    printf("journal:      %zu bytes\n", data.size());
+    printf("eventos:      %llu em %u ticks, %u checkpoints\n",
+           static_cast<unsigned long long>(r.events), r.ticks, r.checkpoints);
+    printf("tempo:        %.3f ms\n", ms);
+    if (!r.ok) {
+        printf("replay FALHOU: %s\n", r.error.c_str());
+        return 1;
+    }
+    printf("replay OK\n");
+    return 0;
+}
+
+// Modo headless:
+//   main --headless [--matches N] [--seed S] [--threads T]
+//                   [--player random|attack|defend|special|1,1,3]
+//                   [--enemy  random|attack|defend|special|1,1,3]
+int runHeadless(int argc, char** argv) {
+    SimulationConfig config;
+    config.player = playerPrefab();
+    config.enemy = enemyPrefab();
+    unsigned threads = std::thread::hardware_concurrency();
+
+    for (int i = 1; i < argc; ++i) {
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : ""; };
+        if (!strcmp(argv[i], "--headless")) continue;
+        else if (!strcmp(argv[i], "--matches")) config.matches = strtoull(next(), nullptr, 10);
+        else if (!strcmp(argv[i], "--seed")) config.seed = strtoull(next(), nullptr, 10);
+        else if (!strcmp(argv[i], "--threads")) threads = static_cast<unsigned>(atoi(next()));
+        else if (!strcmp(argv[i], "--player")) config.playerPolicy = Policy::parse(next());
+        else if (!strcmp(argv[i], "--enemy")) config.enemyPolicy = Policy::parse(next());
+        else {
+            cerr << "argumento desconhecido: " << argv[i] << "\n";
+            return 2;
+        }
+    }
+
+    ThreadPool pool(threads ? threads : 1);
+    CombatSimulator sim(std::move(config));
+    auto t0 = chrono::steady_clock::now();
+    SimulationStats stats = sim.run(pool);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+    stats.print();
+    printf("tempo:             %.2fs (%.0f partidas/s, %zu threads)\n",
+           seconds, static_cast<double>(stats.matches) / seconds, pool.size());
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const char* recordPath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--headless")) return runHeadless(argc, argv);
+        if (!strcmp(argv[i], "--replay") && i + 1 < argc) return runReplay(argv[i + 1]);
+        if (!strcmp(argv[i], "--record") && i + 1 < argc) recordPath = argv[++i];
+    }
+
+    ECS ecs;
+
+    EntityID player = playerPrefab().instantiate(ecs);
+    EntityID enemy = enemyPrefab().instantiate(ecs);
 
     RenderSystem renderer;
-    CombatSystem combat(eventBus);
+    CombatSystem combat(ecs);
     InputSystem input;
 
-    // Registra handlers
-    combat.registerHandlers(ecs);
+    // Toda partida interativa é gravada; --record salva o journal no fim
+    EventJournal<CombatEvents> journal;
+    EventBus<CombatEvents, CombatSystem, EventJournal<CombatEvents>> eventBus(combat, journal);
 
     bool playerTurn = true;
     bool running = true;
+    uint32_t turn = 0;
 
     while (running) {
+        journal.tick(turn++);
+
         // Render
         renderer.draw(ecs);
 
@@ -42,27 +139,42 @@ int main() {
             int choice = input.askChoice();
 
             switch (choice) {
-                case 1: eventBus.send(Event{EvtType::Attack, player, enemy}); break;
-                case 2: eventBus.send(Event{EvtType::Defend, player, player}); break;
-                case 3: eventBus.send(Event{EvtType::Special, player, enemy}); break;
+                case 1: eventBus.post(AttackEvent{player, enemy}); break;
+                case 2: eventBus.post(DefendEvent{player}); break;
+                case 3: eventBus.post(SpecialEvent{player, enemy}); break;
             }
 
             playerTurn = false;
         } else {
-            eventBus.send(Event{EvtType::Attack, enemy, player});
+            eventBus.post(AttackEvent{enemy, player});
             playerTurn = true;
         }
 
-        // Condição de fim
-        auto ph = ecs.getComponent<HealthComponent>(player);
-        auto eh = ecs.getComponent<HealthComponent>(enemy);
+        // Aplica as ações do turno
+        eventBus.flush();
+        journal.checkpoint(combatStateHash(ecs));
 
-        if (ph && eh && (ph->currentHP <= 0 || eh->currentHP <= 0)) {
+        // Condição de fim: alguém com HP <= 0. Com dois lutadores a varredura
+        // é mais barata que um FieldIndex (que só compensa com ~100k entidades)
+        bool someoneDown = false;
+        ecs.view<const HealthComponent>().each([&](EntityID, const HealthComponent& hp) {
+            if (hp.currentHP <= 0) someoneDown = true;
+        });
+        if (someoneDown) {
             renderer.draw(ecs);
             cout << "\n=== FIM DO COMBATE ===\n";
             running = false;
         }
     }
 
+    if (recordPath) {
+        if (journal.save(recordPath)) {
+            cout << "journal salvo em " << recordPath << " (" << journal.eventCount() << " eventos, "
+                 << journal.bytes().size() << " bytes)\n";
+        } else {
+            cerr << "nao foi possivel salvar " << recordPath << "\n";
+        }
+    }
+
     return 0;
 }
@@ -3,6 +3,8 @@
 #include "../Application/Application.hpp"
 #include "../Renderer/Renderer.hpp"
 #include "../Events/EventBus.hpp"
+#include "../Events/Topics.hpp"
+#include "../Simulation/Simulation.hpp"
 
 // ============================================================
 //  Application  –  orquestra tudo
@@ -15,6 +17,10 @@
 //
 //  Render thread (dentro de Renderer) faz:
 //    - clear / draw / display
+//
+//  Simulation thread faz:
+//    - passos fixos do mundo ECS do preview
+//    - publica RenderSnapshot no triple buffer do SharedState
 // ============================================================
 
 class Application {
@@ -22,6 +28,10 @@ public:
     Application()
         : m_window(sf::VideoMode({1280, 720}), "ECS SFML Engine")
         , m_renderer(m_window, m_state, m_font)
+        , m_simulation(m_state, Simulation::Bounds{
+              Sidebar::WIDTH, 0.f,
+              m_window.getSize().x - Sidebar::WIDTH,
+              m_window.getSize().y - ConsoleBar::HEIGHT})
     {
         // Carrega fonte embutida do sistema (fallback simples)
         // Em produção, use um .ttf no diretório do projeto
@@ -37,9 +47,22 @@ public:
 
         // ── Conecta EventBus ──────────────────────────────────
         // Quando qualquer botão for clicado, escreve no console
-        EventBus::instance().subscribe("button_clicked",
-            [this](const std::string& label) {
-                m_state.pushConsole("[click] " + label);
+        engine::EventBus::instance().subscribe(Topics::buttonClicked,
+            [this](const ButtonClicked& e) {
+                m_state.pushConsole("[click] " + std::string(e.label));
+            });
+
+        // Botões que comandam a simulação; a fila é lock-free, então o
+        // handler nunca espera um passo em andamento
+        engine::EventBus::instance().subscribe(Topics::buttonClicked,
+            [this](const ButtonClicked& e) {
+                switch (e.index) {
+                    case 0: m_simulation.post({SimCommand::Kind::Spawn, 1000}); break;
+                    case 1: m_simulation.post({SimCommand::Kind::Clear}); break;
+                    case 3: m_simulation.post({SimCommand::Kind::TogglePause}); break;
+                    case 5: m_simulation.post({SimCommand::Kind::Save}); break;
+                    default: break;
+                }
             });
     }
 
@@ -48,6 +71,11 @@ public:
         //    o render thread (regra SFML 3 para multithreading)
         m_window.setActive(false);
         m_renderer.start();
+        m_simulation.start();
+
+        // Handlers de eventos de UI rodam numa thread de dispatch;
+        // input nunca espera trabalho do editor (DropOldest não bloqueia)
+        engine::EventBus::instance().startAsync(engine::AsyncConfig{4096, 1, engine::AsyncPolicy::DropOldest});
 
         // ── Event loop (main thread) ──────────────────────────
         while (m_window.isOpen()) {
@@ -106,17 +134,16 @@ public:
             }
         }
 
-        // Aguarda render thread terminar limpo
+        // Entrega eventos pendentes antes que os handlers (que capturam this) morram
+        engine::EventBus::instance().stopAsync();
+
+        // Aguarda render e simulação terminarem limpo
         m_renderer.join();
+        m_simulation.join();
     }
 
 private:
     void handleKeyShortcut(sf::Keyboard::Key key) {
-        static const std::vector<std::string> names = {
-            "Spawn Entity", "Clear Scene", "Toggle Debug",
-            "Run System",   "Load Asset",  "Save State"
-        };
-
         int idx = -1;
         if (key == sf::Keyboard::Key::Num1 || key == sf::Keyboard::Key::Numpad1) idx = 0;
         if (key == sf::Keyboard::Key::Num2 || key == sf::Keyboard::Key::Numpad2) idx = 1;
@@ -126,8 +153,8 @@ private:
         if (key == sf::Keyboard::Key::Num6 || key == sf::Keyboard::Key::Numpad6) idx = 5;
 
         if (idx >= 0) {
-            EventBus::instance().publish("button_clicked",
-                std::to_string(idx + 1) + ". " + names[idx]);
+            engine::EventBus::instance().publishAsync(Topics::buttonClicked,
+                ButtonClicked{idx, Actions::LABELS[idx]});
         }
     }
 
@@ -135,4 +162,5 @@ private:
     sf::RenderWindow m_window;
     SharedState      m_state;
     Renderer         m_renderer;
+    Simulation       m_simulation;
 };
@@ -1,41 +1,440 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <functional>
-#include <unordered_map>
-#include <vector>
-#include <string>
+#include <memory>
 #include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "../Threading/BoundedQueue.hpp"
 
 // ============================================================
-//  EventBus  –  pub/sub desacoplado, thread-safe para leitura
-//  Subscribers se registram com um string "topic".
-//  Publishers disparam eventos com um payload (string).
+//  EventBus  –  pub/sub desacoplado, thread-safe
+//  Tópicos são registrados uma vez por nome e viram um handle
+//  inteiro tipado; publish é um índice num array, sem hash de
+//  string nem alocação. O payload é um struct passado por
+//  referência.
+//
+//  Cada tópico aponta para uma lista imutável de handlers,
+//  trocada atomicamente a cada subscribe (copy-on-write).
+//  publish não toma mutex: publishers concorrentes não se
+//  serializam e um handler pode publicar de novo.
+//
+//    struct ButtonClicked { int index; std::string_view label; };
+//    auto clicked = engine::EventBus::instance().topic<ButtonClicked>("button_clicked");
+//    engine::EventBus::instance().subscribe(clicked, [](const ButtonClicked& e) { ... });
+//    engine::EventBus::instance().publish(clicked, ButtonClicked{0, "1. Spawn Entity"});
+//
+//  publishAsync copia o payload para uma fila lock-free limitada
+//  e volta na hora; threads de dispatch (startAsync) esvaziam a
+//  fila em lotes e rodam os handlers. A política do bus decide o
+//  que acontece sob pressão: Block espera vaga, DropOldest descarta
+//  o evento mais antigo e Coalesce mantém só o payload mais recente
+//  de cada tópico. A política vale para o bus todo: numa fila FIFO
+//  única, descartar o mais antigo para um tópico descartaria
+//  eventos de outro que pediu Block.
+//
+//  Tudo fica em namespace engine: o exemplo de combate tem o seu
+//  próprio EventBus (template), e os dois entram no mesmo binário
+//  dos benchmarks.
 // ============================================================
 
+namespace engine {
+
+enum class AsyncPolicy : std::uint8_t {
+    Block,       // produtor espera vaga (não usar na thread de input). Num handler
+                 // async (thread de dispatch) não espera: com a fila cheia, entrega
+                 // ali mesmo, como publish — esperar ali seria esperar por si mesmo.
+    DropOldest,  // descarta o evento mais antigo da fila
+    Coalesce     // no máximo um pendente por tópico; o novo substitui o antigo.
+                 // A fila nunca enche: guarda no máximo um token por tópico.
+};
+
+struct AsyncConfig {
+    std::size_t capacity    = 4096;  // arredondada para potência de 2
+    unsigned    dispatchers = 1;     // mais de um: handlers em paralelo, sem ordem global
+    AsyncPolicy policy      = AsyncPolicy::DropOldest;
+};
+
+// Contadores do caminho assíncrono (leitura aproximada, sem lock)
+struct AsyncStats {
+    std::uint64_t published  = 0;
+    std::uint64_t dispatched = 0;
+    std::uint64_t dropped    = 0;  // descartados por DropOldest
+    std::uint64_t coalesced  = 0;  // substituídos por um payload mais novo
+    std::uint64_t blocked    = 0;  // publishes que encontraram a fila cheia em Block
+    std::size_t   depth      = 0;
+    std::size_t   maxDepth   = 0;
+    std::size_t   capacity   = 0;
+    double        avgLatencyUs = 0.0;  // publishAsync → início do handler
+    double        maxLatencyUs = 0.0;
+};
+
+// Handle de um tópico registrado; só o EventBus cria
+template<typename Payload>
+class Topic {
+public:
+    using PayloadType = Payload;
+
+    std::uint32_t id() const { return m_id; }
+
+private:
+    friend class EventBus;
+    explicit Topic(std::uint32_t id) : m_id(id) {}
+    std::uint32_t m_id;
+};
+
 class EventBus {
 public:
-    using Handler = std::function<void(const std::string& payload)>;
+    static constexpr std::uint32_t MAX_TOPICS = 256;
+    static constexpr std::size_t   MAX_ASYNC_PAYLOAD = 48;
 
     static EventBus& instance() {
         static EventBus bus;
         return bus;
     }
 
-    void subscribe(const std::string& topic, Handler handler) {
+    // Registra o tópico (ou devolve o já registrado com o mesmo nome).
+    // Registrar o mesmo nome com outro payload é erro de programação.
+    template<typename Payload>
+    Topic<Payload> topic(std::string_view name) {
         std::lock_guard lock(m_mutex);
-        m_handlers[topic].push_back(std::move(handler));
+        for (std::uint32_t i = 0; i < m_topicCount; ++i) {
+            if (m_topics[i].name != name) continue;
+            if (m_topics[i].type != typeTag<Payload>())
+                throw std::logic_error("topico '" + std::string(name) + "' registrado com outro payload");
+            return Topic<Payload>(i);
+        }
+        if (m_topicCount == MAX_TOPICS)
+            throw std::length_error("EventBus: limite de topicos atingido");
+        m_topics[m_topicCount].name = std::string(name);
+        m_topics[m_topicCount].type = typeTag<Payload>();
+        return Topic<Payload>(m_topicCount++);
     }
 
-    void publish(const std::string& topic, const std::string& payload = "") {
+    // handler: qualquer chamável com assinatura void(const Payload&).
+    // Copia a lista atual do tópico, acrescenta o handler e publica a
+    // cópia; publishers em andamento terminam com a lista antiga.
+    template<typename Payload, typename Handler>
+    void subscribe(Topic<Payload> topic, Handler handler) {
         std::lock_guard lock(m_mutex);
-        auto it = m_handlers.find(topic);
-        if (it != m_handlers.end()) {
-            for (auto& h : it->second)
-                h(payload);
+        const ErasedHandler& erased = m_handlerStore.emplace_back(
+            [h = std::move(handler)](const void* payload) { h(*static_cast<const Payload*>(payload)); });
+
+        auto& slot = m_topics[topic.id()];
+        auto next = std::make_unique<HandlerList>();
+        if (const HandlerList* current = slot.handlers.load(std::memory_order_relaxed))
+            *next = *current;
+        next->push_back(&erased);
+        slot.handlers.store(next.get(), std::memory_order_release);
+        m_lists.push_back(std::move(next));
+    }
+
+    // Sem lock: lê o snapshot da lista e roda os handlers fora de
+    // qualquer mutex. Pode ser chamado de dentro de um handler.
+    template<typename Payload>
+    void publish(Topic<Payload> topic, const typename Topic<Payload>::PayloadType& payload) {
+        const HandlerList* list = m_topics[topic.id()].handlers.load(std::memory_order_acquire);
+        if (!list) return;
+        for (const ErasedHandler* h : *list)
+            (*h)(&payload);
+    }
+
+    // ── Caminho assíncrono ───────────────────────────────────
+
+    // Aloca a fila (só na primeira vez) e lança as threads de dispatch
+    void startAsync(const AsyncConfig& config = {}) {
+        std::lock_guard lock(m_mutex);
+        if (m_asyncRunning.load(std::memory_order_relaxed)) return;
+        if (!m_queue)
+            m_queue = std::make_unique<BoundedQueue<AsyncEntry>>(std::max<std::size_t>(config.capacity, MAX_TOPICS));
+        m_policy.store(config.policy, std::memory_order_relaxed);
+        m_asyncRunning.store(true, std::memory_order_release);
+        for (unsigned i = 0; i < std::max(1u, config.dispatchers); ++i)
+            m_dispatchers.emplace_back(&EventBus::dispatchLoop, this);
+    }
+
+    // Entrega o que ainda está na fila e encerra as threads de dispatch.
+    // Depois disso publishAsync volta a entregar na hora; um publishAsync
+    // que corra com o stop pode ficar na fila até o próximo startAsync.
+    void stopAsync() {
+        std::vector<std::thread> threads;
+        {
+            std::lock_guard lock(m_mutex);
+            m_asyncRunning.store(false, std::memory_order_release);
+            threads.swap(m_dispatchers);
+        }
+        {
+            std::lock_guard lock(m_idleMutex);
+            m_idleCv.notify_all();
         }
+        for (auto& t : threads) t.join();
     }
 
+    // Enfileira uma cópia do payload e retorna sem rodar handlers.
+    // O payload precisa ser trivialmente copiável; ponteiros e views
+    // nele devem apontar para dados que vivam até o dispatch.
+    template<typename Payload>
+    void publishAsync(Topic<Payload> topic, const typename Topic<Payload>::PayloadType& payload) {
+        static_assert(std::is_trivially_copyable_v<Payload>, "payload assincrono precisa ser trivialmente copiavel");
+        static_assert(sizeof(Payload) <= MAX_ASYNC_PAYLOAD, "payload assincrono maior que MAX_ASYNC_PAYLOAD");
+        static_assert(alignof(Payload) <= alignof(std::max_align_t), "payload assincrono superalinhado");
+
+        if (!m_asyncRunning.load(std::memory_order_acquire)) {
+            publish(topic, payload);
+            return;
+        }
+        AsyncEntry e;
+        e.topic      = topic.id();
+        e.deliver    = &deliverAsync<Payload>;
+        e.enqueuedAt = nowNs();
+        std::memcpy(e.payload, &payload, sizeof(Payload));
+        m_counters.published.fetch_add(1, std::memory_order_relaxed);
+        enqueue(e);
+    }
+
+    AsyncStats asyncStats() const {
+        AsyncStats s;
+        s.published  = m_counters.published.load(std::memory_order_relaxed);
+        s.dispatched = m_counters.dispatched.load(std::memory_order_relaxed);
+        s.dropped    = m_counters.dropped.load(std::memory_order_relaxed);
+        s.coalesced  = m_counters.coalesced.load(std::memory_order_relaxed);
+        s.blocked    = m_counters.blocked.load(std::memory_order_relaxed);
+        s.maxDepth   = m_counters.maxDepth.load(std::memory_order_relaxed);
+        if (m_queue) {
+            s.depth    = m_queue->sizeApprox();
+            s.capacity = m_queue->capacity();
+        }
+        if (s.dispatched) {
+            s.avgLatencyUs = static_cast<double>(m_counters.latencyNs.load(std::memory_order_relaxed))
+                           / static_cast<double>(s.dispatched) / 1000.0;
+        }
+        s.maxLatencyUs = static_cast<double>(m_counters.maxLatencyNs.load(std::memory_order_relaxed)) / 1000.0;
+        return s;
+    }
+
+    ~EventBus() { stopAsync(); }
+
 private:
+    using ErasedHandler = std::function<void(const void* payload)>;
+    using HandlerList   = std::vector<const ErasedHandler*>;
+
+    // Evento copiado para a fila: payload em bytes + quem sabe entregá-lo
+    struct AsyncEntry {
+        std::uint32_t topic = 0;
+        void (*deliver)(EventBus&, const AsyncEntry&) = nullptr;
+        std::int64_t  enqueuedAt = 0;
+        alignas(std::max_align_t) unsigned char payload[MAX_ASYNC_PAYLOAD];
+    };
+
+    struct TopicSlot {
+        std::string                     name;
+        const void*                     type = nullptr;
+        std::atomic<const HandlerList*> handlers{nullptr};
+
+        // Coalesce: último payload pendente; a fila só carrega um token
+        std::atomic<bool> mailboxBusy{false};
+        bool              mailboxPending = false;
+        AsyncEntry        mailbox;
+
+        void lockMailbox() {
+            while (mailboxBusy.exchange(true, std::memory_order_acquire))
+                std::this_thread::yield();
+        }
+        void unlockMailbox() { mailboxBusy.store(false, std::memory_order_release); }
+    };
+
+    struct Counters {
+        std::atomic<std::uint64_t> published{0};
+        std::atomic<std::uint64_t> dispatched{0};
+        std::atomic<std::uint64_t> dropped{0};
+        std::atomic<std::uint64_t> coalesced{0};
+        std::atomic<std::uint64_t> blocked{0};
+        std::atomic<std::size_t>   maxDepth{0};
+        std::atomic<std::uint64_t> latencyNs{0};
+        std::atomic<std::uint64_t> maxLatencyNs{0};
+    };
+
+    static constexpr std::size_t DISPATCH_BATCH = 64;
+
+    static std::int64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static void atomicMax(std::atomic<std::uint64_t>& target, std::uint64_t v) {
+        std::uint64_t cur = target.load(std::memory_order_relaxed);
+        while (cur < v && !target.compare_exchange_weak(cur, v, std::memory_order_relaxed)) {}
+    }
+
+    template<typename Payload>
+    static void deliverAsync(EventBus& bus, const AsyncEntry& e) {
+        bus.publish(Topic<Payload>(e.topic), *std::launder(reinterpret_cast<const Payload*>(e.payload)));
+    }
+
+    // Token de Coalesce: retira o payload mais recente do tópico e entrega
+    static void deliverMailbox(EventBus& bus, const AsyncEntry& token) {
+        auto& slot = bus.m_topics[token.topic];
+        slot.lockMailbox();
+        AsyncEntry latest = slot.mailbox;
+        slot.mailboxPending = false;
+        slot.unlockMailbox();
+        latest.deliver(bus, latest);
+    }
+
+    void enqueue(const AsyncEntry& e) {
+        AsyncPolicy policy = m_policy.load(std::memory_order_relaxed);
+        if (policy == AsyncPolicy::Coalesce) {
+            auto& slot = m_topics[e.topic];
+            slot.lockMailbox();
+            bool alreadyQueued = slot.mailboxPending;
+            if (alreadyQueued) {
+                // mantém o instante do primeiro publish: a latência conta a espera toda
+                std::int64_t since = slot.mailbox.enqueuedAt;
+                slot.mailbox = e;
+                slot.mailbox.enqueuedAt = since;
+            } else {
+                slot.mailbox = e;
+                slot.mailboxPending = true;
+            }
+            slot.unlockMailbox();
+            if (alreadyQueued) {
+                m_counters.coalesced.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            AsyncEntry token;
+            token.topic      = e.topic;
+            token.deliver    = &EventBus::deliverMailbox;
+            token.enqueuedAt = e.enqueuedAt;
+            pushDroppingOldest(token);
+        } else if (policy == AsyncPolicy::Block) {
+            if (!m_queue->tryPush(e)) {
+                m_counters.blocked.fetch_add(1, std::memory_order_relaxed);
+                if (tlsDispatcher == this) {
+                    e.deliver(*this, e);  // só esta thread esvaziaria a fila
+                    return;
+                }
+                while (!m_queue->tryPush(e)) {
+                    if (!m_asyncRunning.load(std::memory_order_acquire)) {
+                        e.deliver(*this, e);  // dispatchers encerrados: entrega aqui
+                        return;
+                    }
+                    std::this_thread::yield();
+                }
+            }
+        } else {
+            pushDroppingOldest(e);
+        }
+        std::size_t depth = m_queue->sizeApprox();
+        std::size_t maxDepth = m_counters.maxDepth.load(std::memory_order_relaxed);
+        while (maxDepth < depth && !m_counters.maxDepth.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed)) {}
+        wakeDispatcher();
+    }
+
+    void pushDroppingOldest(const AsyncEntry& e) {
+        while (!m_queue->tryPush(e)) {
+            AsyncEntry old;
+            if (!m_queue->tryPop(old)) continue;
+            if (old.deliver == &EventBus::deliverMailbox) {
+                // o token some junto com o payload que ele representava
+                auto& slot = m_topics[old.topic];
+                slot.lockMailbox();
+                slot.mailboxPending = false;
+                slot.unlockMailbox();
+            }
+            m_counters.dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Só toca no mutex se algum dispatcher estiver dormindo
+    void wakeDispatcher() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_sleepers.load(std::memory_order_relaxed) == 0) return;
+        std::lock_guard lock(m_idleMutex);
+        m_idleCv.notify_one();
+    }
+
+    void dispatchLoop() {
+        tlsDispatcher = this;
+        AsyncEntry batch[DISPATCH_BATCH];
+        for (;;) {
+            std::size_t n = 0;
+            while (n < DISPATCH_BATCH && m_queue->tryPop(batch[n])) ++n;
+            if (n == 0) {
+                if (!m_asyncRunning.load(std::memory_order_acquire)) return;
+                waitForWork();
+                continue;
+            }
+            std::int64_t now = nowNs();
+            std::uint64_t latencySum = 0, latencyMax = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                auto latency = static_cast<std::uint64_t>(std::max<std::int64_t>(0, now - batch[i].enqueuedAt));
+                latencySum += latency;
+                latencyMax = std::max(latencyMax, latency);
+                batch[i].deliver(*this, batch[i]);
+            }
+            m_counters.dispatched.fetch_add(n, std::memory_order_relaxed);
+            m_counters.latencyNs.fetch_add(latencySum, std::memory_order_relaxed);
+            atomicMax(m_counters.maxLatencyNs, latencyMax);
+        }
+    }
+
+    void waitForWork() {
+        std::unique_lock lock(m_idleMutex);
+        m_sleepers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_queue->sizeApprox() == 0 && m_asyncRunning.load(std::memory_order_acquire))
+            m_idleCv.wait_for(lock, std::chrono::milliseconds(50));
+        m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // Identidade do tipo de payload sem RTTI: um endereço por tipo
+    template<typename Payload>
+    static const void* typeTag() {
+        static const char tag = 0;
+        return &tag;
+    }
+
     EventBus() = default;
-    std::mutex m_mutex;
-    std::unordered_map<std::string, std::vector<Handler>> m_handlers;
+
+    // Bus cujo dispatchLoop roda nesta thread (Block não espera nela)
+    static inline thread_local const EventBus* tlsDispatcher = nullptr;
+
+    std::mutex m_mutex;  // serializa só topic() e subscribe()
+
+    // Slots fixos: publish indexa sem lock, então o array nunca realoca
+    std::array<TopicSlot, MAX_TOPICS> m_topics;
+    std::uint32_t                     m_topicCount = 0;
+
+    // Handlers nunca mudam de endereço; as listas só guardam ponteiros.
+    // Listas substituídas não são liberadas até o fim do bus: um publish
+    // em outra thread ainda pode estar percorrendo uma delas. Subscribe
+    // é raro (inicialização), então o custo é algumas listas pequenas.
+    std::deque<ErasedHandler>                 m_handlerStore;
+    std::vector<std::unique_ptr<HandlerList>> m_lists;
+
+    // Assíncrono: a fila nunca é liberada antes do bus, então um
+    // publishAsync que corra com stopAsync não acessa memória solta
+    std::unique_ptr<BoundedQueue<AsyncEntry>> m_queue;
+    std::vector<std::thread>                  m_dispatchers;
+    std::atomic<bool>                         m_asyncRunning{false};
+    std::atomic<AsyncPolicy>                  m_policy{AsyncPolicy::DropOldest};
+    std::mutex                                m_idleMutex;
+    std::condition_variable                   m_idleCv;
+    std::atomic<unsigned>                     m_sleepers{0};
+    Counters                                  m_counters;
 };
+
+} // namespace engine
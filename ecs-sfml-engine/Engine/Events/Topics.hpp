@@ -0,0 +1,20 @@
+#pragma once
+#include <string_view>
+#include "EventBus.hpp"
+
+// ============================================================
+//  Topics  –  payloads e handles dos tópicos da engine
+//  Cada tópico é registrado uma vez, na inicialização; quem
+//  publica ou assina usa o handle direto.
+// ============================================================
+
+// Botão da sidebar acionado (clique ou atalho 1–6)
+struct ButtonClicked {
+    int              index;  // posição do botão, a partir de 0
+    std::string_view label;  // aponta para Actions::LABELS (estático), seguro no publishAsync
+};
+
+namespace Topics {
+    inline const engine::Topic<ButtonClicked> buttonClicked =
+        engine::EventBus::instance().topic<ButtonClicked>("button_clicked");
+}
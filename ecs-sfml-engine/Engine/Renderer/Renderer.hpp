@@ -2,6 +2,7 @@
 #include <SFML/Graphics.hpp>
 #include <thread>
 #include "../Threading/SharedState.hpp"
+#include "SpriteRenderer.hpp"
 #include "../UI/UI.hpp"
 
 // ============================================================
@@ -17,6 +18,11 @@
 //    3. main() lança Renderer::start()
 //    4. Renderer::loop() chama window.setActive(true)
 //    5. Render loop roda independente do event loop
+//
+//  O preview da content area vem da Simulation: a cada frame o
+//  render pega o último RenderSnapshot completo do triple buffer
+//  (sem lock) e o SpriteRenderer desenha as entidades em lotes,
+//  interpolando entre os dois últimos passos fixos.
 // ============================================================
 
 class Renderer {
@@ -43,6 +49,9 @@ public:
     // Expõe o sidebar para o event loop delegar input de mouse
     Sidebar& sidebar() { return m_sidebar; }
 
+    // Registro de texturas dos sprites (antes de start())
+    SpriteRenderer& sprites() { return m_sprites; }
+
 private:
     void loop() {
         // Ativa o contexto OpenGL nesta thread
@@ -64,6 +73,9 @@ private:
         divider.setSize({1.f, static_cast<float>(m_window.getSize().y)});
         divider.setFillColor(Theme::ACCENT);
 
+        // Reaproveitado entre frames; só é recopiado quando o log muda
+        ConsoleSnapshot console;
+
         while (m_state.running) {
             m_window.clear(Theme::SIDEBAR_BG);
 
@@ -71,12 +83,15 @@ private:
             m_window.draw(contentArea);
             m_window.draw(divider);
 
+            // Preview – entidades da simulação, um draw por lote
+            m_sprites.draw(m_window, m_state.preview.latest());
+
             // UI – sidebar (botões)
             m_sidebar.draw(m_window);
 
-            // UI – console com snapshot thread-safe
-            auto lines = m_state.snapshotConsole();
-            m_console.draw(m_window, lines);
+            // UI – console: copia só as linhas visíveis, e só se houve log novo
+            m_state.snapshotConsole(console, ConsoleBar::VISIBLE_LINES);
+            m_console.draw(m_window, console.lines, console.first);
 
             m_window.display();
         }
@@ -89,5 +104,6 @@ private:
     SharedState&      m_state;
     Sidebar           m_sidebar;
     ConsoleBar        m_console;
+    SpriteRenderer    m_sprites;
     std::thread       m_thread;
 };
@@ -0,0 +1,102 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Threading/SharedState.hpp"
+
+// ============================================================
+//  SpriteBatch  –  quads das entidades do preview, em lotes
+//
+//  Parte só de CPU do estágio de sprites (o lado SFML fica em
+//  SpriteRenderer.hpp), então roda headless nos benchmarks.
+//
+//  Cada RenderItem tem uma chave de lote (camada, material,
+//  textura). A simulação ordena os itens pela chave ao publicar
+//  o snapshot; o render só interpola posições, escreve 6
+//  vértices por item num buffer contíguo e corta um lote a cada
+//  troca de chave — um draw por lote.
+// ============================================================
+
+// Camada no byte mais alto: ordenar pela chave desenha camada por
+// camada e, dentro dela, agrupa material e textura
+inline std::uint32_t batchKey(std::uint8_t layer, std::uint8_t material, std::uint16_t texture) {
+    return (static_cast<std::uint32_t>(layer) << 24)
+         | (static_cast<std::uint32_t>(material) << 16)
+         | texture;
+}
+
+struct SpriteBatchRange {
+    std::uint32_t key;
+    std::size_t   first;  // primeiro vértice
+    std::size_t   count;  // vértices
+
+    std::uint8_t  layer()    const { return static_cast<std::uint8_t>(key >> 24); }
+    std::uint8_t  material() const { return static_cast<std::uint8_t>(key >> 16); }
+    std::uint16_t texture()  const { return static_cast<std::uint16_t>(key); }
+};
+
+// Radix sort LSD estável por RenderItem::key, 8 bits por passada.
+// Passadas em que todos os itens caem no mesmo balde (o normal: poucas
+// camadas, materiais e texturas) são puladas. Estável para que a ordem
+// dentro de um lote não mude entre snapshots e não haja flicker.
+inline void sortByBatchKey(std::vector<RenderItem>& items, std::vector<RenderItem>& scratch) {
+    const std::size_t n = items.size();
+    if (n < 2) return;
+
+    std::array<std::array<std::size_t, 256>, 4> counts{};
+    for (const RenderItem& it : items)
+        for (int b = 0; b < 4; ++b) ++counts[b][(it.key >> (8 * b)) & 0xFF];
+
+    scratch.resize(n);
+    for (int b = 0; b < 4; ++b) {
+        std::array<std::size_t, 256>& c = counts[b];
+        if (c[(items[0].key >> (8 * b)) & 0xFF] == n) continue;
+
+        std::size_t offset = 0;
+        for (std::size_t& slot : c) {
+            std::size_t k = slot;
+            slot = offset;
+            offset += k;
+        }
+        for (const RenderItem& it : items)
+            scratch[c[(it.key >> (8 * b)) & 0xFF]++] = it;
+        items.swap(scratch);
+    }
+}
+
+// Escreve 6 vértices por item (dois triângulos), com a posição
+// interpolada entre o passo anterior e o atual, e os lotes (itens
+// consecutivos com a mesma chave). `items` já vem ordenado.
+// make(x, y, color, u, v) constrói o vértice do destino (sf::Vertex no
+// render, um struct simples nos benchmarks).
+template<typename Vertex, typename MakeVertex>
+void buildSpriteBatches(const std::vector<RenderItem>& items, float alpha,
+                        std::vector<Vertex>& vertices, std::vector<SpriteBatchRange>& batches,
+                        MakeVertex&& make) {
+    vertices.resize(items.size() * 6);
+    batches.clear();
+
+    Vertex* out = vertices.data();
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        const RenderItem& it = items[i];
+        if (batches.empty() || batches.back().key != it.key)
+            batches.push_back(SpriteBatchRange{it.key, i * 6, 0});
+        batches.back().count += 6;
+
+        float x0 = it.prevX + (it.x - it.prevX) * alpha;
+        float y0 = it.prevY + (it.y - it.prevY) * alpha;
+        float x1 = x0 + it.size, y1 = y0 + it.size;
+        float u0 = it.u, v0 = it.v, u1 = it.u + it.uw, v1 = it.v + it.vh;
+
+        Vertex a = make(x0, y0, it.color, u0, v0);
+        Vertex c = make(x1, y1, it.color, u1, v1);
+        out[0] = a;
+        out[1] = make(x1, y0, it.color, u1, v0);
+        out[2] = c;
+        out[3] = a;
+        out[4] = c;
+        out[5] = make(x0, y1, it.color, u0, v1);
+        out += 6;
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "../Simulation/PreviewComponents.hpp"
+#include "../Threading/SharedState.hpp"
+#include "SpriteBatch.hpp"
+
+// ============================================================
+//  SpriteRenderer  –  estágio de sprites do render thread
+//
+//  Desenha o RenderSnapshot da simulação: gera os vértices de
+//  todos os lotes num std::vector<sf::Vertex> persistente, sobe
+//  tudo de uma vez para um sf::VertexBuffer (Stream) e emite um
+//  draw por lote, com a textura e o blend do lote. Sem suporte
+//  a VBO, desenha cada lote direto do vector — ainda um draw
+//  por lote e nenhuma cópia extra.
+//
+//  Texturas são registradas antes de Renderer::start(); o id
+//  devolvido vai em Sprite2D::texture (0 = sem textura).
+// ============================================================
+
+class SpriteRenderer {
+public:
+    // Só antes do render thread começar; a textura precisa viver até o fim
+    std::uint16_t registerTexture(const sf::Texture& texture) {
+        m_textures.push_back(&texture);
+        return static_cast<std::uint16_t>(m_textures.size() - 1);
+    }
+
+    // Render thread, com o contexto ativo
+    void draw(sf::RenderTarget& target, const RenderSnapshot& snap) {
+        float alpha = 1.f;
+        if (snap.dt > 0.f) {
+            float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - snap.time).count();
+            alpha = std::clamp(elapsed / snap.dt, 0.f, 1.f);
+        }
+
+        buildSpriteBatches(snap.items, alpha, m_vertices, m_batches,
+            [](float x, float y, std::uint32_t color, float u, float v) {
+                return sf::Vertex{{x, y}, sf::Color(color), {u, v}};
+            });
+        if (m_vertices.empty()) return;
+
+        // Consulta o driver na primeira vez, já com o contexto desta thread
+        if (!m_checkedBuffer) {
+            m_useBuffer     = sf::VertexBuffer::isAvailable();
+            m_checkedBuffer = true;
+        }
+        if (m_useBuffer) {
+            // Cresce em dobro para não recriar o VBO a cada spawn
+            if (m_buffer.getVertexCount() < m_vertices.size()
+                && !m_buffer.create(std::max(m_vertices.size(), m_buffer.getVertexCount() * 2)))
+                m_useBuffer = false;
+            if (m_useBuffer && !m_buffer.update(m_vertices.data(), m_vertices.size(), 0))
+                m_useBuffer = false;
+        }
+
+        for (const SpriteBatchRange& batch : m_batches) {
+            sf::RenderStates states;
+            states.texture   = batch.texture() < m_textures.size() ? m_textures[batch.texture()] : nullptr;
+            states.blendMode = static_cast<SpriteMaterial>(batch.material()) == SpriteMaterial::Additive
+                             ? sf::BlendAdd : sf::BlendAlpha;
+            if (m_useBuffer)
+                target.draw(m_buffer, batch.first, batch.count, states);
+            else
+                target.draw(m_vertices.data() + batch.first, batch.count, sf::PrimitiveType::Triangles, states);
+        }
+    }
+
+    // Draws emitidos no último frame
+    std::size_t batchCount() const { return m_batches.size(); }
+
+private:
+    std::vector<const sf::Texture*> m_textures{nullptr};  // id 0 = sem textura
+    std::vector<sf::Vertex>         m_vertices;
+    std::vector<SpriteBatchRange>   m_batches;
+    sf::VertexBuffer                m_buffer{sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Stream};
+    bool                            m_checkedBuffer = false;
+    bool                            m_useBuffer = false;
+};
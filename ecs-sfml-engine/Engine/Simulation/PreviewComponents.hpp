@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+
+// ============================================================
+//  Componentes das entidades do preview (content area)
+//
+//  Coordenadas em pixels da janela. Transform2D guarda também a
+//  posição do passo anterior para o render interpolar entre os
+//  dois passos fixos da simulação.
+// ============================================================
+
+struct Transform2D {
+    float x, y;
+    float prevX, prevY;
+};
+
+struct Velocity2D {
+    float vx, vy;  // pixels por segundo
+};
+
+// Materiais do preview (modo de blend no render)
+enum class SpriteMaterial : std::uint8_t { Alpha = 0, Additive = 1 };
+
+struct Sprite2D {
+    std::uint32_t  color;          // 0xRRGGBBAA
+    float          size;           // lado do quad, em pixels
+    std::uint16_t  texture = 0;    // id registrado no render; 0 = sem textura
+    std::uint8_t   layer = 0;      // ordem de desenho (maior por cima)
+    SpriteMaterial material = SpriteMaterial::Alpha;
+    float          u = 0.f, v = 0.f, uw = 0.f, vh = 0.f;  // retângulo na textura, em pixels
+};
@@ -0,0 +1,222 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include "../../../ecs-example/ECS.h"
+#include "../../../ecs-example/Prefab.h"
+#include "../../../ecs-example/Snapshot.h"
+#include "../Renderer/SpriteBatch.hpp"
+#include "../Threading/BoundedQueue.hpp"
+#include "../Threading/SharedState.hpp"
+#include "PreviewComponents.hpp"
+
+// ============================================================
+//  Simulation  –  roda em thread dedicada, a passo fixo
+//
+//  Dono exclusivo do mundo ECS do preview: só esta thread toca
+//  nele. A UI manda comandos por uma fila lock-free (post) e o
+//  render recebe um RenderSnapshot por passo via triple buffer
+//  no SharedState — nenhum dos três threads espera os outros.
+//  Os itens do snapshot saem ordenados por lote (batchKey), então
+//  o render não ordena nada.
+//
+//  O passo é fixo (STEP) e independe do framerate/vsync do
+//  render. Se um passo demorar mais que STEP, os seguintes
+//  rodam em sequência para alcançar o relógio, até
+//  MAX_CATCHUP_STEPS; além disso o atraso é descartado em vez
+//  de acumular para sempre (contado em RenderSnapshot::droppedSteps
+//  e avisado no console). O snapshot sai uma vez por rodada de
+//  catch-up: o render só veria o último.
+// ============================================================
+
+struct SimCommand {
+    enum class Kind : std::uint8_t { Spawn, Clear, TogglePause, Save };
+
+    Kind          kind;
+    std::uint32_t count = 0;  // Spawn: quantas entidades
+};
+
+class Simulation {
+public:
+    static constexpr double STEP              = 1.0 / 120.0;
+    static constexpr int    MAX_CATCHUP_STEPS = 8;
+
+    // Retângulo da content area em que as entidades quicam
+    struct Bounds {
+        float left, top, width, height;
+    };
+
+    Simulation(SharedState& state, Bounds bounds)
+        : m_state(state), m_bounds(bounds), m_commands(256) {
+        m_prefab.with(Transform2D{0.f, 0.f, 0.f, 0.f})
+                .with(Velocity2D{0.f, 0.f})
+                .with(Sprite2D{0xFFFFFFFFu, 4.f});
+    }
+
+    void start() {
+        m_thread = std::thread(&Simulation::loop, this);
+    }
+
+    // Sai junto com o render, quando state.running vira false
+    void join() {
+        if (m_thread.joinable())
+            m_thread.join();
+    }
+
+    // Qualquer thread. Fila cheia descarta o comando (e avisa no console).
+    void post(SimCommand cmd) {
+        if (!m_commands.tryPush(cmd))
+            m_state.pushConsole("[sim] fila de comandos cheia, comando descartado");
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void loop() {
+        const auto step = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(STEP));
+        auto next = Clock::now();
+        auto lastDropReport = next;
+        float lastStepMs = 0.f;
+
+        while (m_state.running) {
+            SimCommand cmd;
+            while (m_commands.tryPop(cmd)) apply(cmd);
+
+            auto now = Clock::now();
+            int steps = 0;
+            while (next <= now && steps < MAX_CATCHUP_STEPS) {
+                auto t0 = Clock::now();
+                if (!m_paused) this->step(static_cast<float>(STEP));
+                lastStepMs = std::chrono::duration<float, std::milli>(Clock::now() - t0).count();
+                next += step;
+                ++steps;
+            }
+            // prevX/prevY guardam o penúltimo passo: interpolar entre os dois
+            // últimos vale igual com um ou oito passos na rodada
+            if (steps > 0) publish(next - step, lastStepMs, !m_paused);
+
+            if (next <= now) {
+                // Ainda atrasado depois do catch-up: descarta o atraso
+                std::uint64_t dropped = static_cast<std::uint64_t>((now - next) / step) + 1;
+                m_droppedSteps += dropped;
+                next = now + step;
+                if (now - lastDropReport >= std::chrono::seconds(1)) {
+                    m_state.pushConsole("[sim] atrasada: " + std::to_string(m_droppedSteps)
+                                        + " passos descartados ate agora");
+                    lastDropReport = now;
+                }
+            }
+            std::this_thread::sleep_until(next);
+        }
+    }
+
+    void step(float dt) {
+        const float minX = m_bounds.left, maxX = m_bounds.left + m_bounds.width;
+        const float minY = m_bounds.top,  maxY = m_bounds.top + m_bounds.height;
+        m_world.view<Transform2D, Velocity2D, const Sprite2D>().each(
+            [&](EntityID, Transform2D& t, Velocity2D& v, const Sprite2D& s) {
+                t.prevX = t.x;
+                t.prevY = t.y;
+                t.x += v.vx * dt;
+                t.y += v.vy * dt;
+                // Quica nas bordas da content area
+                if (t.x < minX || t.x + s.size > maxX) {
+                    v.vx = -v.vx;
+                    t.x = std::clamp(t.x, minX, maxX - s.size);
+                }
+                if (t.y < minY || t.y + s.size > maxY) {
+                    v.vy = -v.vy;
+                    t.y = std::clamp(t.y, minY, maxY - s.size);
+                }
+            });
+        ++m_step;
+    }
+
+    // Copia o estado para o back do triple buffer, ordena por lote e publica.
+    // Pausada, a posição anterior é a atual para o render não interpolar.
+    void publish(Clock::time_point stepTime, float stepMs, bool moving) {
+        RenderSnapshot& snap = m_state.preview.back();
+        snap.step   = m_step;
+        snap.time   = stepTime;
+        snap.dt     = static_cast<float>(STEP);
+        snap.stepMs = stepMs;
+        snap.droppedSteps = m_droppedSteps;
+        snap.items.clear();
+        m_world.view<const Transform2D, const Sprite2D>().each(
+            [&](EntityID, const Transform2D& t, const Sprite2D& s) {
+                snap.items.push_back(RenderItem{
+                    moving ? t.prevX : t.x, moving ? t.prevY : t.y, t.x, t.y, s.size, s.color,
+                    batchKey(s.layer, static_cast<std::uint8_t>(s.material), s.texture),
+                    s.u, s.v, s.uw, s.vh});
+            });
+        sortByBatchKey(snap.items, m_sortScratch);
+        m_state.preview.publish();
+    }
+
+    void apply(const SimCommand& cmd) {
+        switch (cmd.kind) {
+            case SimCommand::Kind::Spawn:       spawn(cmd.count); break;
+            case SimCommand::Kind::Clear:       clear(); break;
+            case SimCommand::Kind::TogglePause: togglePause(); break;
+            case SimCommand::Kind::Save:        save(); break;
+        }
+    }
+
+    void spawn(std::uint32_t count) {
+        std::vector<EntityID> ids = m_world.createEntities(count, m_prefab);
+        std::uniform_real_distribution<float> px(m_bounds.left, m_bounds.left + m_bounds.width - 8.f);
+        std::uniform_real_distribution<float> py(m_bounds.top, m_bounds.top + m_bounds.height - 8.f);
+        std::uniform_real_distribution<float> speed(-240.f, 240.f);
+        std::uniform_int_distribution<std::uint32_t> channel(96, 255);
+        std::uniform_int_distribution<int> layer(0, 2);
+        std::uniform_int_distribution<int> material(0, 3);
+        for (EntityID id : ids) {
+            float x = px(m_rng), y = py(m_rng);
+            *m_world.getComponent<Transform2D>(id) = Transform2D{x, y, x, y};
+            *m_world.getComponent<Velocity2D>(id) = Velocity2D{speed(m_rng), speed(m_rng)};
+
+            // Camadas de trás menores; 1 em 4 somada (brilho) em vez de misturada
+            Sprite2D& sprite = *m_world.getComponent<Sprite2D>(id);
+            sprite.layer    = static_cast<std::uint8_t>(layer(m_rng));
+            sprite.size     = 3.f + 2.f * sprite.layer;
+            sprite.material = material(m_rng) == 0 ? SpriteMaterial::Additive : SpriteMaterial::Alpha;
+            sprite.color    = (channel(m_rng) << 24) | (channel(m_rng) << 16) | (channel(m_rng) << 8)
+                            | (sprite.material == SpriteMaterial::Additive ? 0x80u : 0xFFu);
+        }
+        m_state.pushConsole("[sim] +" + std::to_string(count) + " entidades (total "
+                            + std::to_string(m_world.getEntities().size()) + ")");
+    }
+
+    void clear() {
+        m_world.clear();
+        m_state.pushConsole("[sim] cena limpa");
+    }
+
+    void togglePause() {
+        m_paused = !m_paused;
+        m_state.pushConsole(m_paused ? "[sim] pausada" : "[sim] rodando");
+    }
+
+    void save() {
+        WorldSnapshot snap;
+        snap.add<Transform2D>("Transform2D").add<Velocity2D>("Velocity2D").add<Sprite2D>("Sprite2D");
+        bool ok = snap.save(m_world, "preview.ecss");
+        m_state.pushConsole(ok ? "[sim] estado salvo em preview.ecss" : "[sim] falha ao salvar preview.ecss");
+    }
+
+    SharedState&             m_state;
+    Bounds                   m_bounds;
+    ECS                      m_world;
+    Prefab                   m_prefab;
+    std::mt19937             m_rng{12345};
+    std::vector<RenderItem>  m_sortScratch;
+    BoundedQueue<SimCommand> m_commands;
+    std::uint64_t            m_step = 0;
+    std::uint64_t            m_droppedSteps = 0;
+    bool                     m_paused = false;
+    std::thread              m_thread;
+};
@@ -0,0 +1,96 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+// ============================================================
+//  BoundedQueue  –  fila circular lock-free, vários produtores
+//  e vários consumidores (algoritmo de Dmitry Vyukov).
+//
+//  Cada célula guarda um número de sequência que diz de quem é
+//  a vez: produtor e consumidor disputam só um CAS no índice de
+//  cauda/cabeça e nunca esperam um pelo outro. Capacidade fixa
+//  (arredondada para potência de 2), alocada na construção;
+//  push/pop não alocam.
+// ============================================================
+
+template<typename T>
+class BoundedQueue {
+    static_assert(std::is_trivially_copyable_v<T>, "BoundedQueue guarda T por cópia de bytes");
+
+public:
+    explicit BoundedQueue(std::size_t capacity) {
+        std::size_t cap = 2;
+        while (cap < capacity) cap <<= 1;
+        m_mask  = cap - 1;
+        m_cells = std::make_unique<Cell[]>(cap);
+        for (std::size_t i = 0; i < cap; ++i)
+            m_cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    // false se a fila estiver cheia
+    bool tryPush(const T& value) {
+        std::size_t pos = m_tail.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            std::size_t seq = cell->seq.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // false se a fila estiver vazia
+    bool tryPop(T& out) {
+        std::size_t pos = m_head.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            std::size_t seq = cell->seq.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_head.load(std::memory_order_relaxed);
+            }
+        }
+        out = cell->value;
+        cell->seq.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Aproximado sob concorrência; exato com a fila parada
+    std::size_t sizeApprox() const {
+        std::size_t tail = m_tail.load(std::memory_order_acquire);
+        std::size_t head = m_head.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    std::size_t capacity() const { return m_mask + 1; }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> seq{0};
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    std::size_t             m_mask = 0;
+
+    // Cabeça e cauda em linhas de cache separadas
+    alignas(64) std::atomic<std::size_t> m_tail{0};
+    alignas(64) std::atomic<std::size_t> m_head{0};
+};
@@ -0,0 +1,133 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// ============================================================
+//  ConsoleLog  –  log do console em anel de capacidade fixa
+//
+//  Cada linha ocupa um slot pré-alocado (texto truncado em
+//  LINE_BYTES). Produtores pegam um ticket com fetch_add e
+//  escrevem no slot ticket % capacidade sob um seqlock; o
+//  render lê sem lock e descarta a linha se o slot mudou no
+//  meio da cópia. Ninguém aloca ao escrever e o render nunca
+//  bloqueia um produtor (nem o contrário).
+//
+//  version() sobe a cada linha publicada: o render só copia
+//  quando ela mudou desde o último snapshot.
+// ============================================================
+
+// Linhas copiadas pelo render; as strings são reaproveitadas entre frames
+struct ConsoleSnapshot {
+    std::uint64_t            version = 0;
+    std::uint64_t            first   = 0;  // número da primeira linha em `lines`
+    std::vector<std::string> lines;
+};
+
+class ConsoleLog {
+public:
+    static constexpr std::size_t LINE_BYTES = 160;
+
+    explicit ConsoleLog(std::size_t capacity = 1024)
+        : m_capacity(std::max<std::size_t>(capacity, 1))
+        , m_slots(std::make_unique<Slot[]>(m_capacity)) {}
+
+    // Thread-safe, sem lock. Só espera se o anel der uma volta inteira
+    // enquanto o escritor anterior do mesmo slot ainda está copiando.
+    void push(std::string_view line) {
+        std::uint64_t ticket = m_next.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = m_slots[ticket % m_capacity];
+
+        std::uint64_t previous = ticket >= m_capacity ? committed(ticket - m_capacity) : 0;
+        while (slot.seq.load(std::memory_order_acquire) != previous)
+            std::this_thread::yield();
+
+        slot.seq.store(committed(ticket) - 1, std::memory_order_relaxed);  // ímpar: escrevendo
+        std::atomic_thread_fence(std::memory_order_release);
+
+        std::size_t len = std::min(line.size(), LINE_BYTES);
+        for (std::size_t w = 0; w * 8 < len; ++w) {
+            std::uint64_t word = 0;
+            std::memcpy(&word, line.data() + w * 8, std::min<std::size_t>(8, len - w * 8));
+            slot.words[w].store(word, std::memory_order_relaxed);
+        }
+        slot.len.store(static_cast<std::uint32_t>(len), std::memory_order_relaxed);
+
+        slot.seq.store(committed(ticket), std::memory_order_release);
+        m_version.fetch_add(1, std::memory_order_release);
+    }
+
+    std::uint64_t version() const { return m_version.load(std::memory_order_acquire); }
+    std::size_t   capacity() const { return m_capacity; }
+
+    // Copia as últimas `maxLines` linhas para `out` se algo mudou desde
+    // out.version; devolve false (e não copia nada) caso contrário.
+    // `out.lines` é sempre um trecho contíguo do log a partir de out.first:
+    // linhas iniciais já sobrescritas são puladas, e a cópia para na
+    // primeira linha ainda em escrita (com vários produtores, t + 1 pode
+    // terminar antes de t). O que ficou de fora aparece no próximo snapshot.
+    bool snapshot(ConsoleSnapshot& out, std::size_t maxLines = SIZE_MAX) const {
+        std::uint64_t v = version();
+        if (v == out.version) return false;
+
+        std::uint64_t end   = m_next.load(std::memory_order_acquire);
+        std::uint64_t count = std::min<std::uint64_t>({end, static_cast<std::uint64_t>(m_capacity),
+                                                      static_cast<std::uint64_t>(maxLines)});
+        std::uint64_t begin = end - count;
+
+        std::size_t n = 0;
+        out.lines.resize(count);
+        char text[WORDS * 8];
+        for (std::uint64_t t = begin; t < end; ++t) {
+            std::size_t len;
+            if (!read(t, text, len)) {
+                if (n == 0) continue;
+                break;
+            }
+            if (n == 0) out.first = t;
+            out.lines[n++].assign(text, len);
+        }
+        out.lines.resize(n);
+        out.version = v;
+        return true;
+    }
+
+private:
+    static constexpr std::size_t WORDS = (LINE_BYTES + 7) / 8;
+
+    struct Slot {
+        // par: linha completa (2 * ticket + 2); ímpar: escrita em andamento
+        std::atomic<std::uint64_t> seq{0};
+        std::atomic<std::uint32_t> len{0};
+        std::atomic<std::uint64_t> words[WORDS] = {};
+    };
+
+    static std::uint64_t committed(std::uint64_t ticket) { return 2 * ticket + 2; }
+
+    bool read(std::uint64_t ticket, char* text, std::size_t& len) const {
+        const Slot& slot = m_slots[ticket % m_capacity];
+        std::uint64_t s1 = slot.seq.load(std::memory_order_acquire);
+        if (s1 != committed(ticket)) return false;
+
+        len = std::min<std::size_t>(slot.len.load(std::memory_order_relaxed), LINE_BYTES);
+        for (std::size_t w = 0; w * 8 < len; ++w) {
+            std::uint64_t word = slot.words[w].load(std::memory_order_relaxed);
+            std::memcpy(text + w * 8, &word, 8);  // text tem WORDS * 8 bytes
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.seq.load(std::memory_order_relaxed) == s1;
+    }
+
+    std::size_t                m_capacity;
+    std::unique_ptr<Slot[]>    m_slots;
+    std::atomic<std::uint64_t> m_next{0};     // próximo ticket
+    std::atomic<std::uint64_t> m_version{0};  // linhas publicadas
+};
@@ -1,8 +1,11 @@
 #pragma once
-#include <string>
-#include <vector>
-#include <mutex>
+#include <string_view>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "ConsoleLog.hpp"
+#include "TripleBuffer.hpp"
 
 // ============================================================
 //  SharedState  –  dados trocados entre main thread e render
@@ -16,25 +19,44 @@
 //  thread deve ser protegido por mutex ou atomic.
 // ============================================================
 
+// Uma entidade do preview como o render precisa: posição nos dois
+// últimos passos fixos, para interpolar, e a aparência
+struct RenderItem {
+    float         prevX, prevY;
+    float         x, y;
+    float         size;
+    std::uint32_t color;  // 0xRRGGBBAA
+    std::uint32_t key;    // lote: camada, material e textura (ver batchKey)
+    float         u, v, uw, vh;
+};
+
+// Estado do mundo publicado pela simulação ao fim de um passo
+struct RenderSnapshot {
+    std::uint64_t                         step = 0;
+    std::chrono::steady_clock::time_point time;        // instante agendado do passo
+    float                                 dt = 0.f;     // duração do passo fixo, em segundos
+    float                                 stepMs = 0.f; // custo real do último passo
+    std::uint64_t                         droppedSteps = 0; // passos descartados por atraso, acumulado
+    std::vector<RenderItem>               items;
+};
+
 struct SharedState {
     // Sinaliza ao render thread que deve parar
     std::atomic<bool> running{ true };
 
-    // Log de mensagens exibido no console bar
-    std::vector<std::string> consoleLines;
-    std::mutex consoleMutex;
+    // Log de mensagens exibido no console bar (anel lock-free)
+    ConsoleLog console{1024};
+
+    // Simulação → render: último passo completo, sem lock
+    TripleBuffer<RenderSnapshot> preview;
 
-    void pushConsole(const std::string& msg) {
-        std::lock_guard lock(consoleMutex);
-        consoleLines.push_back(msg);
-        // Limita histórico a 20 linhas
-        if (consoleLines.size() > 20)
-            consoleLines.erase(consoleLines.begin());
+    // Qualquer thread; não aloca nem bloqueia o render
+    void pushConsole(std::string_view msg) {
+        console.push(msg);
     }
 
-    // Captura thread-safe de todas as linhas para o render
-    std::vector<std::string> snapshotConsole() {
-        std::lock_guard lock(consoleMutex);
-        return consoleLines;
+    // Render thread: copia só se algo foi logado desde o último snapshot
+    bool snapshotConsole(ConsoleSnapshot& out, std::size_t maxLines = SIZE_MAX) const {
+        return console.snapshot(out, maxLines);
     }
 };
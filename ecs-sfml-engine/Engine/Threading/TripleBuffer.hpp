@@ -0,0 +1,48 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// ============================================================
+//  TripleBuffer  –  troca lock-free entre um escritor e um leitor
+//
+//  Três instâncias de T: o escritor preenche a sua (back), o
+//  leitor lê a sua (front) e a terceira fica no meio com a
+//  última versão completa. publish() e latest() trocam de
+//  buffer com um único exchange atômico — nenhum dos lados
+//  espera o outro, e o leitor sempre vê um T inteiro.
+//
+//  O escritor reescreve o back por completo a cada publish;
+//  o conteúdo anterior do buffer é de duas publicações atrás.
+// ============================================================
+
+template<typename T>
+class TripleBuffer {
+public:
+    // Escritor: buffer livre para preencher
+    T& back() { return m_buffers[m_back]; }
+
+    // Escritor: torna o back a versão mais recente
+    void publish() {
+        std::uint8_t old = m_middle.exchange(static_cast<std::uint8_t>(m_back | FRESH), std::memory_order_acq_rel);
+        m_back = old & INDEX;
+    }
+
+    // Leitor: versão completa mais recente (a mesma do frame anterior se
+    // nada foi publicado desde então)
+    const T& latest() {
+        if (m_middle.load(std::memory_order_relaxed) & FRESH) {
+            std::uint8_t old = m_middle.exchange(m_front, std::memory_order_acq_rel);
+            m_front = old & INDEX;
+        }
+        return m_buffers[m_front];
+    }
+
+private:
+    static constexpr std::uint8_t INDEX = 0x3;
+    static constexpr std::uint8_t FRESH = 0x4;  // meio tem dados que o leitor não viu
+
+    T m_buffers[3];
+    alignas(64) std::uint8_t              m_back = 0;   // só o escritor
+    alignas(64) std::atomic<std::uint8_t> m_middle{1};
+    alignas(64) std::uint8_t              m_front = 2;  // só o leitor
+};
@@ -0,0 +1,234 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ============================================================
+//  TextLayer  –  texto retido da UI, em quads de glyph prontos
+//
+//  Cada linha é diagramada uma vez (glyphs, kerning, quads com
+//  coordenadas do atlas) e fica em cache pela sua chave. A cada
+//  frame a UI declara as linhas visíveis (begin/add/end); só as
+//  com texto novo são refeitas, e o buffer de vértices só é
+//  remontado se algo mudou de lugar, cor ou conteúdo. Tudo cabe
+//  num único draw contra a textura da fonte.
+//
+//  Não depende do SFML: as métricas vêm de um GlyphSource (o
+//  adaptador de sf::Font fica em UI.hpp), então layout e montagem
+//  de vértices rodam headless em testes e benchmarks.
+// ============================================================
+
+// Mesmo layout lógico de sf::Vertex; cor em 0xRRGGBBAA
+struct UiVertex {
+    float         x, y;
+    std::uint32_t color;
+    float         u, v;  // pixels no atlas
+};
+
+struct GlyphMetrics {
+    float advance = 0.f;
+    // Caixa do glyph relativa à origem no baseline
+    float left = 0.f, top = 0.f, width = 0.f, height = 0.f;
+    // Retângulo no atlas da fonte, em pixels
+    float texLeft = 0.f, texTop = 0.f, texWidth = 0.f, texHeight = 0.f;
+};
+
+class GlyphSource {
+public:
+    virtual ~GlyphSource() = default;
+    virtual unsigned     characterSize() const = 0;
+    virtual GlyphMetrics glyph(char32_t c, bool bold) = 0;
+    virtual float        kerning(char32_t first, char32_t second, bool bold) = 0;
+};
+
+// Caixa visível de uma linha diagramada, em coordenadas locais
+struct TextBounds {
+    float left = 0.f, top = 0.f, width = 0.f, height = 0.f;
+};
+
+// Dois triângulos; sem textura o VertexArray ignora u/v
+inline void appendQuad(std::vector<UiVertex>& out, float x, float y, float w, float h,
+                       std::uint32_t color,
+                       float u = 0.f, float v = 0.f, float uw = 0.f, float vh = 0.f) {
+    UiVertex a{x,     y,     color, u,      v};
+    UiVertex b{x + w, y,     color, u + uw, v};
+    UiVertex c{x + w, y + h, color, u + uw, v + vh};
+    UiVertex d{x,     y + h, color, u,      v + vh};
+    out.insert(out.end(), {a, b, c, a, c, d});
+}
+
+// Diagrama uma linha como o sf::Text faria: topo da linha em y = 0,
+// baseline em y = characterSize, 1px de margem em cada glyph. Bytes
+// viram code points um a um (mesma conversão de sf::String(std::string)
+// no locale "C"). Quebras de linha são ignoradas. Vértices saem brancos.
+inline TextBounds layoutLine(GlyphSource& glyphs, std::string_view text, bool bold,
+                             std::vector<UiVertex>& out) {
+    constexpr float PAD = 1.f;
+    const float baseline = static_cast<float>(glyphs.characterSize());
+    const float space    = glyphs.glyph(U' ', bold).advance;
+
+    float x = 0.f;
+    float minX = 0.f, minY = 0.f, maxX = 0.f, maxY = 0.f;
+    bool  any = false;
+    char32_t prev = 0;
+
+    for (char ch : text) {
+        char32_t c = static_cast<unsigned char>(ch);
+        if (c == U'\r' || c == U'\n') continue;
+
+        x += glyphs.kerning(prev, c, bold);
+        prev = c;
+
+        if (c == U' ')  { x += space;       continue; }
+        if (c == U'\t') { x += space * 4.f; continue; }
+
+        GlyphMetrics g = glyphs.glyph(c, bold);
+        if (g.width > 0.f && g.height > 0.f) {
+            appendQuad(out,
+                       x + g.left - PAD, baseline + g.top - PAD,
+                       g.width + 2.f * PAD, g.height + 2.f * PAD,
+                       0xFFFFFFFFu,
+                       g.texLeft - PAD, g.texTop - PAD,
+                       g.texWidth + 2.f * PAD, g.texHeight + 2.f * PAD);
+
+            float l = x + g.left, t = baseline + g.top;
+            if (!any) { minX = l; minY = t; maxX = l + g.width; maxY = t + g.height; any = true; }
+            minX = std::min(minX, l);
+            minY = std::min(minY, t);
+            maxX = std::max(maxX, l + g.width);
+            maxY = std::max(maxY, t + g.height);
+        }
+        x += g.advance;
+    }
+    return TextBounds{minX, minY, maxX - minX, maxY - minY};
+}
+
+class TextLayer {
+public:
+    // TopLeft: (x, y) é o topo-esquerda da linha, como sf::Text::setPosition.
+    // Center:  (x, y) é o centro da caixa visível (arredondado ao pixel).
+    enum class Anchor : std::uint8_t { TopLeft, Center };
+
+    explicit TextLayer(GlyphSource& glyphs) : m_glyphs(glyphs) {}
+
+    // Abre a lista de linhas do frame
+    void begin() {
+        m_frame.clear();
+    }
+
+    // Declara uma linha visível. O layout é reaproveitado enquanto a
+    // chave mantiver o mesmo texto, mesmo que a linha mude de posição.
+    void add(std::uint64_t key, std::string_view text, float x, float y,
+             std::uint32_t color, bool bold = false, Anchor anchor = Anchor::TopLeft) {
+        std::size_t idx = find(key);
+        if (idx == NONE) {
+            idx = freeSlot();
+            m_cache[idx].key = key;
+            m_cache[idx].live = true;
+            relayout(m_cache[idx], text, bold);
+        } else if (m_cache[idx].bold != bold || m_cache[idx].text != text) {
+            relayout(m_cache[idx], text, bold);
+        }
+        Line& line = m_cache[idx];
+        line.touched = true;
+
+        float ox = x, oy = y;
+        if (anchor == Anchor::Center) {
+            ox = std::round(x - (line.bounds.left + line.bounds.width / 2.f));
+            oy = std::round(y - (line.bounds.top + line.bounds.height / 2.f));
+        }
+        m_frame.push_back(Placement{idx, line.generation, ox, oy, color});
+    }
+
+    // Fecha o frame: libera linhas não declaradas e remonta os vértices
+    // se algo mudou. Devolve true quando vertices() mudou.
+    bool end() {
+        for (Line& line : m_cache) {
+            if (!line.touched) line.live = false;
+            line.touched = false;
+        }
+
+        bool changed = m_frame.size() != m_drawn.size();
+        for (std::size_t i = 0; !changed && i < m_frame.size(); ++i)
+            changed = !(m_frame[i] == m_drawn[i]);
+        if (!changed) return false;
+
+        std::size_t total = 0;
+        for (const Placement& p : m_frame) total += m_cache[p.line].quads.size();
+        m_vertices.resize(total);
+
+        UiVertex* out = m_vertices.data();
+        for (const Placement& p : m_frame) {
+            for (const UiVertex& v : m_cache[p.line].quads)
+                *out++ = UiVertex{v.x + p.x, v.y + p.y, p.color, v.u, v.v};
+        }
+        std::swap(m_frame, m_drawn);
+        return true;
+    }
+
+    const std::vector<UiVertex>& vertices() const { return m_vertices; }
+
+    // Quantas vezes alguma linha foi diagramada (misses do cache)
+    std::uint64_t layoutCount() const { return m_layouts; }
+
+private:
+    static constexpr std::size_t NONE = static_cast<std::size_t>(-1);
+
+    struct Line {
+        std::uint64_t         key = 0;
+        std::uint64_t         generation = 0;  // muda a cada relayout
+        std::string           text;
+        bool                  bold = false;
+        bool                  live = false;     // ocupada por uma chave
+        bool                  touched = false;  // declarada neste frame
+        TextBounds            bounds;
+        std::vector<UiVertex> quads;            // coordenadas locais, brancos
+    };
+
+    struct Placement {
+        std::size_t   line;
+        std::uint64_t generation;
+        float         x, y;
+        std::uint32_t color;
+
+        bool operator==(const Placement& o) const {
+            return line == o.line && generation == o.generation
+                && x == o.x && y == o.y && color == o.color;
+        }
+    };
+
+    // A UI tem poucas linhas por camada; busca linear basta
+    std::size_t find(std::uint64_t key) const {
+        for (std::size_t i = 0; i < m_cache.size(); ++i)
+            if (m_cache[i].live && m_cache[i].key == key) return i;
+        return NONE;
+    }
+
+    // Reaproveita uma linha liberada (e seus buffers) antes de crescer
+    std::size_t freeSlot() {
+        for (std::size_t i = 0; i < m_cache.size(); ++i)
+            if (!m_cache[i].live) return i;
+        m_cache.emplace_back();
+        return m_cache.size() - 1;
+    }
+
+    void relayout(Line& line, std::string_view text, bool bold) {
+        line.text.assign(text);
+        line.bold = bold;
+        line.quads.clear();
+        line.bounds = layoutLine(m_glyphs, text, bold, line.quads);
+        ++line.generation;
+        ++m_layouts;
+    }
+
+    GlyphSource&           m_glyphs;
+    std::vector<Line>      m_cache;
+    std::vector<Placement> m_frame;   // frame em montagem
+    std::vector<Placement> m_drawn;   // frame que está em m_vertices
+    std::vector<UiVertex>  m_vertices;
+    std::uint64_t          m_layouts = 0;
+};
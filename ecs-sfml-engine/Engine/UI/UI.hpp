@@ -1,9 +1,16 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <functional>
-#include "../Events/EventBus.hpp"
+#include <iterator>
+#include <string_view>
+#include "../Events/Topics.hpp"
+#include "TextLayer.hpp"
 
 // ============================================================
 //  Componentes de UI
@@ -11,6 +18,10 @@
 //  SidebarButton  – botão clicável que publica no EventBus
 //  Sidebar        – painel lateral com lista de botões
 //  ConsoleBar     – painel inferior que exibe linhas de log
+//
+//  Sidebar e console desenham cada um com dois VertexArray:
+//  retângulos (sem textura) e texto (TextLayer contra o atlas da
+//  fonte). Os vértices só são remontados quando algo muda.
 // ============================================================
 
 // ── Paleta de cores ─────────────────────────────────────────
@@ -24,65 +35,125 @@ namespace Theme {
     inline const sf::Color TEXT_PRIMARY{220, 220, 255};
     inline const sf::Color TEXT_DIM    {120, 120, 160};
     inline const sf::Color ACCENT      { 90, 140, 255};
+
+    // Um só tamanho de fonte na UI: todo texto sai da mesma página do atlas
+    inline constexpr unsigned TEXT_SIZE = 13;
+}
+
+// ── FontGlyphs ───────────────────────────────────────────────
+// Adaptador sf::Font → GlyphSource, num tamanho fixo
+class FontGlyphs : public GlyphSource {
+public:
+    FontGlyphs(const sf::Font& font, unsigned size) : m_font(font), m_size(size) {}
+
+    unsigned characterSize() const override { return m_size; }
+
+    GlyphMetrics glyph(char32_t c, bool bold) override {
+        const sf::Glyph& g = m_font.getGlyph(c, m_size, bold);
+        return GlyphMetrics{
+            g.advance,
+            g.bounds.position.x, g.bounds.position.y, g.bounds.size.x, g.bounds.size.y,
+            static_cast<float>(g.textureRect.position.x), static_cast<float>(g.textureRect.position.y),
+            static_cast<float>(g.textureRect.size.x),     static_cast<float>(g.textureRect.size.y)};
+    }
+
+    float kerning(char32_t first, char32_t second, bool bold) override {
+        return m_font.getKerning(first, second, m_size, bold);
+    }
+
+    // Página do atlas deste tamanho; coordenadas em pixels continuam
+    // válidas quando a fonte aumenta a textura
+    const sf::Texture& texture() const { return m_font.getTexture(m_size); }
+
+private:
+    const sf::Font& m_font;
+    unsigned        m_size;
+};
+
+// Copia vértices da UI para o VertexArray desenhado
+inline void uploadVertices(const std::vector<UiVertex>& in, sf::VertexArray& out) {
+    out.resize(in.size());
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        const UiVertex& v = in[i];
+        out[i] = sf::Vertex{{v.x, v.y}, sf::Color(v.color), {v.u, v.v}};
+    }
+}
+
+// ── Ações da sidebar (mesma ordem dos atalhos 1–6) ──────────
+namespace Actions {
+    inline constexpr std::string_view LABELS[] = {
+        "1. Spawn Entity",
+        "2. Clear Scene",
+        "3. Toggle Debug",
+        "4. Run System",
+        "5. Load Asset",
+        "6. Save State",
+    };
+    inline constexpr int COUNT = static_cast<int>(std::size(LABELS));
 }
 
 // ── SidebarButton ────────────────────────────────────────────
+// Input na main thread, desenho no render: a cor de fundo é o único
+// estado que muda depois da construção e é atômica.
 class SidebarButton {
 public:
-    SidebarButton(const std::string& label,
-                  sf::Vector2f pos,
-                  sf::Vector2f size,
-                  const sf::Font& font): m_label(label), m_text(font) // SFML 3: fonte obrigatória no construtor
-    {
-        m_rect.setPosition(pos);
-        m_rect.setSize(size);
-        m_rect.setFillColor(Theme::BTN_NORMAL);
-        m_rect.setOutlineThickness(1.f);
-        m_rect.setOutlineColor(Theme::ACCENT);
-
-        m_text.setString(label);
-        m_text.setCharacterSize(14);
-        m_text.setFillColor(Theme::TEXT_PRIMARY);
-
-        // Centraliza texto verticalmente no botão
-        auto tb = m_text.getLocalBounds();
-        m_text.setOrigin({tb.position.x + tb.size.x,
-                          tb.position.y + tb.size.y / 2.f});
-        m_text.setPosition({pos.x + size.x / 2.f,
-                            pos.y + size.y / 2.f});
-    }
+    SidebarButton(int index, std::string_view label, sf::Vector2f pos, sf::Vector2f size)
+        : m_index(index), m_label(label), m_bounds(pos, size)
+        , m_fill(Theme::BTN_NORMAL.toInteger()) {}
+
+    SidebarButton(SidebarButton&& o) noexcept
+        : m_index(o.m_index), m_label(o.m_label), m_bounds(o.m_bounds)
+        , m_fill(o.m_fill.load(std::memory_order_relaxed)) {}
 
     bool handleMouseMove(sf::Vector2f mouse) {
-        bool over = m_rect.getGlobalBounds().contains(mouse);
-        m_rect.setFillColor(over ? Theme::BTN_HOVER : Theme::BTN_NORMAL);
+        bool over = m_bounds.contains(mouse);
+        setFill(over ? Theme::BTN_HOVER : Theme::BTN_NORMAL);
         return over;
     }
 
     // Retorna true se o clique ocorreu dentro do botão
     bool handleMousePress(sf::Vector2f mouse) {
-        if (m_rect.getGlobalBounds().contains(mouse)) {
-            m_rect.setFillColor(Theme::BTN_PRESS);
-            // Publica evento com o nome do botão como payload
-            EventBus::instance().publish("button_clicked", m_label);
+        if (m_bounds.contains(mouse)) {
+            setFill(Theme::BTN_PRESS);
+            // Publica sem rodar handlers aqui: o clique não espera o editor.
+            // O label aponta para Actions::LABELS, que vive até o dispatch.
+            engine::EventBus::instance().publishAsync(Topics::buttonClicked,
+                ButtonClicked{m_index, Actions::LABELS[m_index]});
             return true;
         }
         return false;
     }
 
     void handleMouseRelease(sf::Vector2f mouse) {
-        bool over = m_rect.getGlobalBounds().contains(mouse);
-        m_rect.setFillColor(over ? Theme::BTN_HOVER : Theme::BTN_NORMAL);
+        bool over = m_bounds.contains(mouse);
+        setFill(over ? Theme::BTN_HOVER : Theme::BTN_NORMAL);
+    }
+
+    std::uint32_t fill() const { return m_fill.load(std::memory_order_relaxed); }
+
+    // Contorno de 1px por fora (como setOutlineThickness(1)) e fundo por cima
+    void appendShapes(std::vector<UiVertex>& out, std::uint32_t fill) const {
+        appendQuad(out, m_bounds.position.x - 1.f, m_bounds.position.y - 1.f,
+                   m_bounds.size.x + 2.f, m_bounds.size.y + 2.f, Theme::ACCENT.toInteger());
+        appendQuad(out, m_bounds.position.x, m_bounds.position.y,
+                   m_bounds.size.x, m_bounds.size.y, fill);
     }
 
-    void draw(sf::RenderWindow& window) const {
-        window.draw(m_rect);
-        window.draw(m_text);
+    // Label centralizado no botão
+    void addLabel(TextLayer& text) const {
+        text.add(static_cast<std::uint64_t>(m_index), m_label,
+                 m_bounds.position.x + m_bounds.size.x / 2.f,
+                 m_bounds.position.y + m_bounds.size.y / 2.f,
+                 Theme::TEXT_PRIMARY.toInteger(), false, TextLayer::Anchor::Center);
     }
 
 private:
-    std::string        m_label;
-    sf::RectangleShape m_rect;
-    sf::Text           m_text;   // inicializado na member init list
+    void setFill(sf::Color c) { m_fill.store(c.toInteger(), std::memory_order_relaxed); }
+
+    int                        m_index;
+    std::string_view           m_label;   // Actions::LABELS, estático
+    sf::FloatRect              m_bounds;
+    std::atomic<std::uint32_t> m_fill;
 };
 
 // ── Sidebar ──────────────────────────────────────────────────
@@ -91,39 +162,23 @@ public:
     static constexpr float WIDTH = 180.f;
 
     // Constructor
-    Sidebar(float windowHeight, const sf::Font& font): m_title(font) // SFML 3: fonte obrigatória no construtor
+    Sidebar(float windowHeight, const sf::Font& font)
+        : m_height(windowHeight)
+        , m_glyphs(font, Theme::TEXT_SIZE)
+        , m_text(m_glyphs)
     {
-        m_bg.setSize({WIDTH, windowHeight});
-        m_bg.setFillColor(Theme::SIDEBAR_BG);
-
-        // Título
-        m_title.setString("ACTIONS");
-        m_title.setCharacterSize(12);
-        m_title.setFillColor(Theme::ACCENT);
-        m_title.setStyle(sf::Text::Bold);
-        m_title.setPosition({16.f, 16.f});
-
         // Cria botões enumerados
-        const std::vector<std::string> labels = {
-            "1. Spawn Entity",
-            "2. Clear Scene",
-            "3. Toggle Debug",
-            "4. Run System",
-            "5. Load Asset",
-            "6. Save State",
-        };
-
         float yStart = 50.f;
         float btnH   = 38.f;
         float gap    = 10.f;
         float margin = 12.f;
 
-        for (const auto& lbl : labels) {
+        for (int i = 0; i < Actions::COUNT; ++i) {
             m_buttons.emplace_back(
-                lbl,
+                i,
+                Actions::LABELS[i],
                 sf::Vector2f{margin, yStart},
-                sf::Vector2f{WIDTH - margin * 2.f, btnH},
-                font
+                sf::Vector2f{WIDTH - margin * 2.f, btnH}
             );
             
             yStart += btnH + gap;
@@ -142,77 +197,102 @@ public:
         for (auto& btn : m_buttons) btn.handleMouseRelease(mouse);
     }
 
-    void draw(sf::RenderWindow& window) const {
-        window.draw(m_bg);
-        window.draw(m_title);
-        for (const auto& btn : m_buttons) btn.draw(window);
+    // Render thread. Dois draws: retângulos e texto.
+    void draw(sf::RenderWindow& window) {
+        // Retângulos só são remontados quando algum botão troca de cor
+        bool dirty = m_shapes.getVertexCount() == 0;
+        for (int i = 0; i < Actions::COUNT; ++i) {
+            std::uint32_t f = m_buttons[i].fill();
+            if (f != m_drawnFill[i]) dirty = true;
+            m_drawnFill[i] = f;
+        }
+        if (dirty) {
+            m_shapeVerts.clear();
+            appendQuad(m_shapeVerts, 0.f, 0.f, WIDTH, m_height, Theme::SIDEBAR_BG.toInteger());
+            for (int i = 0; i < Actions::COUNT; ++i)
+                m_buttons[i].appendShapes(m_shapeVerts, m_drawnFill[i]);
+            uploadVertices(m_shapeVerts, m_shapes);
+        }
+
+        // Texto: labels estáticos, o layout sai do cache depois do 1º frame
+        m_text.begin();
+        m_text.add(TITLE_KEY, "ACTIONS", 16.f, 16.f, Theme::ACCENT.toInteger(), true);
+        for (const auto& btn : m_buttons) btn.addLabel(m_text);
+        if (m_text.end()) uploadVertices(m_text.vertices(), m_textVerts);
+
+        window.draw(m_shapes);
+        window.draw(m_textVerts, sf::RenderStates(&m_glyphs.texture()));
     }
 
 private:
-    sf::RectangleShape         m_bg;
-    sf::Text                   m_title;
-    std::vector<SidebarButton> m_buttons;
+    static constexpr std::uint64_t TITLE_KEY = ~std::uint64_t(0);
+
+    float                                      m_height;
+    std::vector<SidebarButton>                 m_buttons;
+    FontGlyphs                                 m_glyphs;
+    TextLayer                                  m_text;
+    std::array<std::uint32_t, Actions::COUNT>  m_drawnFill{};
+    std::vector<UiVertex>                      m_shapeVerts;
+    sf::VertexArray                            m_shapes{sf::PrimitiveType::Triangles};
+    sf::VertexArray                            m_textVerts{sf::PrimitiveType::Triangles};
 };
 
 // ── ConsoleBar ───────────────────────────────────────────────
 class ConsoleBar {
 public:
     static constexpr float HEIGHT = 150.f;
+    static constexpr float LINE_HEIGHT = 18.f;
+    // Linhas que cabem no painel
+    static constexpr std::size_t VISIBLE_LINES = static_cast<std::size_t>((HEIGHT - 30.f) / LINE_HEIGHT);
 
     ConsoleBar(float windowWidth, float windowHeight, const sf::Font& font)
-        : m_font(font)
-        , m_title(font) // SFML 3: fonte obrigatória no construtor
+        : m_glyphs(font, Theme::TEXT_SIZE)
+        , m_text(m_glyphs)
     {
         float y = windowHeight - HEIGHT;
 
-        m_bg.setPosition({0.f, y});
-        m_bg.setSize({windowWidth, HEIGHT});
-        m_bg.setFillColor(Theme::CONSOLE_BG);
-
-        m_border.setPosition({0.f, y});
-        m_border.setSize({windowWidth, 1.f});
-        m_border.setFillColor(Theme::ACCENT);
+        // Fundo e borda superior não mudam: montados uma vez
+        std::vector<UiVertex> shapes;
+        appendQuad(shapes, 0.f, y, windowWidth, HEIGHT, Theme::CONSOLE_BG.toInteger());
+        appendQuad(shapes, 0.f, y, windowWidth, 1.f, Theme::ACCENT.toInteger());
+        uploadVertices(shapes, m_shapes);
 
-        m_title.setString("CONSOLE");
-        m_title.setCharacterSize(11);
-        m_title.setFillColor(Theme::ACCENT);
-        m_title.setStyle(sf::Text::Bold);
-        m_title.setPosition({Sidebar::WIDTH + 12.f, y + 8.f});
-
-        m_yOrigin    = y;
+        m_titlePos   = {Sidebar::WIDTH + 12.f, y + 8.f};
         m_lineStart  = y + 28.f;
         m_xStart     = Sidebar::WIDTH + 12.f;
-        m_windowW    = windowWidth;
     }
 
-    // Recebe snapshot das linhas do SharedState e as renderiza
-    void draw(sf::RenderWindow& window, const std::vector<std::string>& lines) const {
-        window.draw(m_bg);
-        window.draw(m_border);
-        window.draw(m_title);
-
-        float lineH = 18.f;
+    // Recebe snapshot das linhas do SharedState e as renderiza.
+    // firstLine é o número da primeira linha do snapshot no log, para a
+    // cor alternada acompanhar a linha e não a posição na tela. O número
+    // também é a chave do cache: uma linha que sobe na tela não é
+    // diagramada de novo, só a que acabou de chegar.
+    void draw(sf::RenderWindow& window, const std::vector<std::string>& lines,
+              std::uint64_t firstLine = 0) {
         // Mostra apenas as últimas N linhas que cabem no painel
-        int maxLines = static_cast<int>((HEIGHT - 30.f) / lineH);
-        int start    = std::max(0, static_cast<int>(lines.size()) - maxLines);
+        std::size_t start = lines.size() > VISIBLE_LINES ? lines.size() - VISIBLE_LINES : 0;
 
-        sf::Text line(m_font);  // SFML 3: fonte obrigatória no construtor
-        line.setCharacterSize(13);
-
-        for (int i = start; i < static_cast<int>(lines.size()); ++i) {
-            float y = m_lineStart + (i - start) * lineH;
+        m_text.begin();
+        m_text.add(TITLE_KEY, "CONSOLE", m_titlePos.x, m_titlePos.y, Theme::ACCENT.toInteger(), true);
+        for (std::size_t i = start; i < lines.size(); ++i) {
+            float y = m_lineStart + static_cast<float>(i - start) * LINE_HEIGHT;
             // Alterna cor para legibilidade
-            line.setFillColor((i % 2 == 0) ? Theme::TEXT_PRIMARY : Theme::TEXT_DIM);
-            line.setString(lines[i]);
-            line.setPosition({m_xStart, y});
-            window.draw(line);
+            const sf::Color& color = ((firstLine + i) % 2 == 0) ? Theme::TEXT_PRIMARY : Theme::TEXT_DIM;
+            m_text.add(firstLine + i, lines[i], m_xStart, y, color.toInteger());
         }
+        if (m_text.end()) uploadVertices(m_text.vertices(), m_textVerts);
+
+        window.draw(m_shapes);
+        window.draw(m_textVerts, sf::RenderStates(&m_glyphs.texture()));
     }
 
 private:
-    sf::RectangleShape m_bg;
-    sf::RectangleShape m_border;
-    sf::Text           m_title;
-    const sf::Font&    m_font;
-    float m_yOrigin, m_lineStart, m_xStart, m_windowW;
+    static constexpr std::uint64_t TITLE_KEY = ~std::uint64_t(0);
+
+    FontGlyphs      m_glyphs;
+    TextLayer       m_text;
+    sf::VertexArray m_shapes{sf::PrimitiveType::Triangles};
+    sf::VertexArray m_textVerts{sf::PrimitiveType::Triangles};
+    sf::Vector2f    m_titlePos;
+    float           m_lineStart, m_xStart;
 };
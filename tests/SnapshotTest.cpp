@@ -0,0 +1,126 @@
+// ============================================================
+//  Testes negativos da carga de snapshot
+//
+//  Grava um mundo válido, corrompe um campo de geração no arquivo
+//  e confere que load() recusa o arquivo sem tocar no mundo de
+//  destino. Sai com código 1 na primeira falha.
+// ============================================================
+#include "../ecs-example/Components.h"
+#include "../ecs-example/Snapshot.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(cond)                                                     \
+    do {                                                                \
+        if (!(cond)) {                                                  \
+            std::printf("%s:%d: falhou: %s\n", __FILE__, __LINE__, #cond); \
+            ++failures;                                                 \
+        }                                                               \
+    } while (0)
+
+std::size_t padded(std::size_t bytes) { return (bytes + 7) / 8 * 8; }
+
+std::vector<char> readFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), {});
+}
+
+void writeFile(const std::string& path, const std::vector<char>& data) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+// Um índice reciclado (geração 1) e um livre na free list
+ECS makeWorld() {
+    ECS ecs;
+    for (int i = 0; i < 10; ++i) {
+        EntityID e = ecs.createEntity();
+        ecs.addComponent(e, HealthComponent{100, i});
+    }
+    ecs.destroyEntity(ecs.getEntities()[3]);
+    EntityID reused = ecs.createEntity();
+    ecs.addComponent(reused, HealthComponent{100, 42});
+    ecs.destroyEntity(ecs.getEntities()[5]);
+    return ecs;
+}
+
+} // namespace
+
+int main() {
+    const std::string good = "snapshot_test_good.ecss";
+    const std::string bad = "snapshot_test_bad.ecss";
+
+    WorldSnapshot snapshot;
+    snapshot.add<HealthComponent>("HealthComponent");
+
+    ECS source = makeWorld();
+    CHECK(snapshot.save(source, good));
+    std::vector<char> data = readFile(good);
+    CHECK(data.size() > sizeof(SnapshotHeader));
+
+    SnapshotHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    CHECK(header.freeCount == 1);
+    const std::size_t entitiesAt = sizeof(SnapshotHeader);
+    const std::size_t generationsAt = entitiesAt + padded(header.entityCount * sizeof(EntityID));
+    const std::size_t entityPosAt = generationsAt + padded(header.indexCount * sizeof(std::uint32_t));
+    const std::size_t freeListAt = entityPosAt + padded(header.indexCount * sizeof(std::uint32_t));
+    const std::size_t ownersAt = freeListAt + padded(header.freeCount * sizeof(std::uint32_t))
+                               + sizeof(SnapshotPoolHeader);
+
+    // Arquivo intacto carrega
+    {
+        ECS loaded;
+        CHECK(snapshot.load(loaded, good));
+        CHECK(loaded.getEntities().size() == source.getEntities().size());
+    }
+
+    // Geração de um índice vivo alterada: a entidade gravada vira fantasma
+    {
+        EntityID first;
+        std::memcpy(&first, data.data() + entitiesAt, sizeof(first));
+        std::vector<char> corrupt = data;
+        corrupt[generationsAt + entityIndex(first) * sizeof(std::uint32_t)] ^= 0x01;
+        writeFile(bad, corrupt);
+
+        ECS target = makeWorld();
+        std::size_t before = target.getEntities().size();
+        CHECK(!snapshot.load(target, bad));
+        CHECK(target.getEntities().size() == before);
+    }
+
+    // Dono de componente com geração velha: índice certo, entidade morta
+    {
+        std::vector<char> corrupt = data;
+        corrupt[ownersAt + sizeof(EntityID) - 1] ^= 0x10;  // bits altos = geração
+        writeFile(bad, corrupt);
+
+        ECS target;
+        CHECK(!snapshot.load(target, bad));
+    }
+
+    // Geração fora do intervalo de ENTITY_GENERATION_MASK num índice livre
+    {
+        std::uint32_t freeIndex;
+        std::memcpy(&freeIndex, data.data() + freeListAt, sizeof(freeIndex));
+        std::vector<char> corrupt = data;
+        corrupt[generationsAt + freeIndex * sizeof(std::uint32_t) + 3] = 0x7F;
+        writeFile(bad, corrupt);
+
+        ECS target;
+        CHECK(!snapshot.load(target, bad));
+    }
+
+    std::remove(good.c_str());
+    std::remove(bad.c_str());
+    if (failures == 0) std::printf("snapshot: ok\n");
+    return failures == 0 ? 0 : 1;
+}